@@ -0,0 +1,1195 @@
+/*
+ * 작업 훔치기 스레드 풀과 fork-join 병렬 알고리즘
+ *
+ * 병합 정렬, 퀵 정렬처럼 문제를 나눠 푸는(분할 정복) 알고리즘은 나눈 부분들을
+ * 서로 다른 스레드에서 동시에 처리할 수 있습니다. 하지만 나눌 때마다 스레드를
+ * 새로 만들면 생성 비용이 크고, 부분 문제의 크기가 고르지 않으면 일부 스레드만
+ * 바쁘게 됩니다.
+ *
+ * 작업 훔치기(work stealing) 스레드 풀은 작업자 스레드를 한 번만 만들고,
+ * 작업자마다 작업 훔치기 덱(WorkStealingDeque.cpp)을 하나씩 둡니다.
+ * - spawn: 새 작업을 자기 덱의 뒤쪽에 넣습니다. (fork)
+ * - sync: spawn 한 작업들이 모두 끝날 때까지, 기다리는 대신 자기 덱의 작업을
+ *   꺼내 처리하거나 다른 작업자의 덱 앞쪽에서 작업을 훔쳐 처리합니다. (join)
+ * 할 일이 없는 작업자가 알아서 일을 가져가므로 부하가 자동으로 고르게
+ * 나뉩니다.
+ *
+ * parallel_for 는 구간을 반으로 나누며 spawn 합니다. 처음에는 작업자 수에 맞춰
+ * 굵게 나누고, 다른 작업자에게 도둑맞은 조각만 더 잘게 나눕니다. 부하가 고르면
+ * 작업 수가 적게 유지되고, 고르지 않을 때만 작업이 늘어납니다.
+ *
+ * 리눅스에서는 NUMA 노드별 CPU 목록을 읽어 작업자를 CPU 에 고정하고, 작업을
+ * 훔칠 때 같은 노드의 작업자를 먼저 살핍니다. (정보를 읽을 수 없으면 CPU
+ * 고정 없이 하나의 노드로 봅니다)
+ *
+ * 이 풀 위에 병합 정렬(MergeSort.cpp), 퀵 정렬(QuickSort.cpp), 너비 우선
+ * 탐색(BreathFirstSearch.cpp)의 병렬 버전을 구현합니다.
+ *
+ */
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <queue>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace std;
+
+// 작업 훔치기 덱 (WorkStealingDeque.cpp 와 같은 구조)
+template <typename T>
+class Deque
+{
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct Array
+    {
+        int64_t capacity;
+        int64_t mask;
+        unique_ptr<atomic<T>[]> slots;
+
+        explicit Array(int64_t c) : capacity(c), mask(c - 1), slots(new atomic<T>[c])
+        {
+        }
+
+        T get(int64_t index)
+        {
+            return slots[index & mask].load(memory_order_relaxed);
+        }
+
+        void put(int64_t index, T value)
+        {
+            slots[index & mask].store(value, memory_order_relaxed);
+        }
+    };
+
+    alignas(CACHE_LINE) atomic<int64_t> top;
+    alignas(CACHE_LINE) atomic<int64_t> bottom;
+    atomic<Array *> array;
+    vector<unique_ptr<Array>> arrays;
+
+public:
+    explicit Deque(int64_t c = 256) : top(0), bottom(0)
+    {
+        arrays.emplace_back(new Array(c));
+        array.store(arrays.back().get(), memory_order_relaxed);
+    }
+
+    void add_rear(T new_data)
+    {
+        int64_t b = bottom.load(memory_order_relaxed);
+        int64_t t = top.load(memory_order_acquire);
+        Array *a = array.load(memory_order_relaxed);
+
+        if (b - t > a->capacity - 1)
+        {
+            arrays.emplace_back(new Array(a->capacity * 2));
+            Array *bigger = arrays.back().get();
+            for (int64_t i = t; i < b; i++)
+            {
+                bigger->put(i, a->get(i));
+            }
+            array.store(bigger, memory_order_release);
+            a = bigger;
+        }
+
+        a->put(b, new_data);
+        bottom.store(b + 1, memory_order_release);
+    }
+
+    bool remove_rear(T &out)
+    {
+        int64_t b = bottom.load(memory_order_relaxed) - 1;
+        Array *a = array.load(memory_order_relaxed);
+        bottom.store(b, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        int64_t t = top.load(memory_order_relaxed);
+
+        if (t > b)
+        {
+            bottom.store(b + 1, memory_order_relaxed);
+            return false;
+        }
+
+        out = a->get(b);
+        if (t < b)
+        {
+            return true;
+        }
+
+        bool won = top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+        bottom.store(b + 1, memory_order_relaxed);
+        return won;
+    }
+
+    bool steal_front(T &out)
+    {
+        int64_t t = top.load(memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        int64_t b = bottom.load(memory_order_acquire);
+
+        if (t >= b)
+        {
+            return false;
+        }
+
+        Array *a = array.load(memory_order_acquire);
+        T value = a->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+        {
+            return false;
+        }
+
+        out = value;
+        return true;
+    }
+
+    int64_t size_approx() const
+    {
+        int64_t b = bottom.load(memory_order_relaxed);
+        int64_t t = top.load(memory_order_relaxed);
+        return b > t ? b - t : 0;
+    }
+};
+
+class ForkJoinPool;
+
+// 작업
+/*
+ * 실행할 함수와, 끝났을 때 알려 줄 작업 그룹을 가집니다. 람다를 그대로 담는
+ * ClosureTask 가 이 구조를 상속합니다.
+ */
+struct Task
+{
+    void (*execute)(Task *);
+};
+
+// 작업 그룹 (spawn / sync)
+/*
+ * spawn 한 작업 중 아직 끝나지 않은 작업 수(pending)를 셉니다. sync 는 이 값이
+ * 0이 될 때까지 다른 작업을 처리하며 기다립니다. 소멸될 때도 sync 합니다.
+ */
+class TaskGroup
+{
+    template <typename F>
+    struct ClosureTask : Task
+    {
+        F function;
+        TaskGroup *group;
+
+        ClosureTask(F &&f, TaskGroup *g) : function(move(f)), group(g)
+        {
+            execute = &run;
+        }
+
+        static void run(Task *task)
+        {
+            ClosureTask *self = static_cast<ClosureTask *>(task);
+            self->function();
+            TaskGroup *group = self->group;
+            delete self;
+
+            // 마지막 작업이 끝나면 sync 가 반환되어 그룹이 사라질 수 있으므로
+            // 그룹에 대한 접근은 이것이 마지막입니다.
+            group->pending.fetch_sub(1, memory_order_release);
+        }
+    };
+
+    ForkJoinPool &pool;
+    atomic<int> pending;
+
+public:
+    explicit TaskGroup(ForkJoinPool &pool) : pool(pool), pending(0)
+    {
+    }
+
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup &operator=(const TaskGroup &) = delete;
+
+    ~TaskGroup()
+    {
+        sync();
+    }
+
+    template <typename F>
+    void spawn(F f);
+
+    void sync();
+};
+
+class ForkJoinPool
+{
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr int SPIN_COUNT = 64;
+
+    struct alignas(CACHE_LINE) Worker
+    {
+        Deque<Task *> deque;
+        int id;
+        int cpu;
+        int node;
+        vector<int> localVictims; // 같은 NUMA 노드의 다른 작업자
+        uint32_t randomState;
+    };
+
+    vector<unique_ptr<Worker>> workers;
+    vector<thread> threads;
+    int nodeCount;
+
+    // 작업자가 아닌 스레드가 spawn 한 작업
+    mutex injectLock;
+    deque<Task *> injectQueue;
+    atomic<int> injectCount;
+
+    // 할 일이 없는 작업자가 잠드는 곳
+    mutex sleepLock;
+    condition_variable sleepCv;
+    atomic<int> sleepers;
+    atomic<bool> stopping;
+
+public:
+    // threadCount 개의 작업자를 만듭니다. (0이면 CPU 수)
+    explicit ForkJoinPool(int threadCount = 0) : nodeCount(1), injectCount(0), sleepers(0), stopping(false)
+    {
+        if (threadCount <= 0)
+        {
+            threadCount = max(1u, thread::hardware_concurrency());
+        }
+
+        // CPU 를 NUMA 노드 순서로 나열해 작업자에게 차례로 배정합니다.
+        vector<vector<int>> nodes = read_numa_nodes();
+        vector<pair<int, int>> cpus; // (cpu, node)
+        for (size_t n = 0; n < nodes.size(); n++)
+        {
+            for (int cpu : nodes[n])
+            {
+                cpus.push_back({ cpu, static_cast<int>(n) });
+            }
+        }
+        nodeCount = max<int>(1, static_cast<int>(nodes.size()));
+
+        for (int i = 0; i < threadCount; i++)
+        {
+            workers.emplace_back(new Worker);
+            Worker &worker = *workers.back();
+            worker.id = i;
+            worker.cpu = cpus.empty() ? -1 : cpus[i % cpus.size()].first;
+            worker.node = cpus.empty() ? 0 : cpus[i % cpus.size()].second;
+            worker.randomState = 2463534242u + 977u * i;
+        }
+        for (auto &worker : workers)
+        {
+            for (auto &other : workers)
+            {
+                if (other->id != worker->id && other->node == worker->node)
+                {
+                    worker->localVictims.push_back(other->id);
+                }
+            }
+        }
+
+        for (int i = 0; i < threadCount; i++)
+        {
+            threads.emplace_back([this, i] { worker_loop(*workers[i]); });
+        }
+    }
+
+    ~ForkJoinPool()
+    {
+        {
+            lock_guard<mutex> guard(sleepLock);
+            stopping.store(true);
+        }
+        sleepCv.notify_all();
+        for (thread &t : threads)
+        {
+            t.join();
+        }
+    }
+
+    ForkJoinPool(const ForkJoinPool &) = delete;
+    ForkJoinPool &operator=(const ForkJoinPool &) = delete;
+
+    int worker_count() const
+    {
+        return static_cast<int>(workers.size());
+    }
+
+    int node_count() const
+    {
+        return nodeCount;
+    }
+
+    // f 를 작업자에게 맡기고 끝날 때까지 기다립니다.
+    template <typename F>
+    void run(F f)
+    {
+        TaskGroup group(*this);
+        group.spawn(move(f));
+        group.sync();
+    }
+
+    // 병렬 반복
+    /*
+     * [begin, end) 의 각 i 에 대해 body(i) 를 호출합니다. grain 은 한 작업이
+     * 처리할 최대 반복 수이며, 0이면 적응형으로 정합니다.
+     * - 처음에는 작업자당 약 4개의 조각이 되도록 굵게 나눕니다.
+     * - 다른 작업자가 훔쳐 간 조각은 8배 더 잘게 나눠, 부하가 몰린 곳에서만
+     *   작업 수를 늘립니다.
+     */
+    template <typename F>
+    void parallel_for(int begin, int end, const F &body, int grain = 0)
+    {
+        if (begin >= end)
+        {
+            return;
+        }
+
+        int n = end - begin;
+        bool adaptive = grain <= 0;
+        if (adaptive)
+        {
+            grain = max(1, n / (4 * worker_count()));
+        }
+
+        if (current_worker() == nullptr)
+        {
+            // 작업자가 아닌 스레드라면 작업자에게 맡깁니다.
+            run([&] { for_range(begin, end, body, grain, adaptive, current_worker()->id); });
+        }
+        else
+        {
+            for_range(begin, end, body, grain, adaptive, current_worker()->id);
+        }
+    }
+
+private:
+    friend class TaskGroup;
+
+    // 현재 스레드가 이 풀의 작업자라면 그 작업자를 반환합니다.
+    Worker *current_worker()
+    {
+        Worker *worker = thread_worker();
+        if (worker == nullptr || worker->id >= worker_count() || workers[worker->id].get() != worker)
+        {
+            return nullptr;
+        }
+        return worker;
+    }
+
+    static Worker *&thread_worker()
+    {
+        thread_local Worker *worker = nullptr;
+        return worker;
+    }
+
+    template <typename F>
+    void for_range(int begin, int end, const F &body, int grain, bool adaptive, int owner)
+    {
+        int self = current_worker()->id;
+        if (adaptive && self != owner)
+        {
+            // 도둑맞은 조각: 더 잘게 나눕니다.
+            grain = max(1, grain / 8);
+            owner = self;
+        }
+
+        TaskGroup group(*this);
+        while (end - begin > grain)
+        {
+            int mid = begin + (end - begin) / 2;
+            group.spawn([this, mid, end, &body, grain, adaptive, owner]
+                {
+                    for_range(mid, end, body, grain, adaptive, owner);
+                });
+            end = mid;
+        }
+
+        for (int i = begin; i < end; i++)
+        {
+            body(i);
+        }
+        group.sync();
+    }
+
+    // 작업 제출
+    /*
+     * 작업자라면 자기 덱에, 아니라면 공용 대기열에 넣은 뒤 잠든 작업자를
+     * 하나 깨웁니다.
+     */
+    void submit(Task *task)
+    {
+        Worker *worker = current_worker();
+        if (worker != nullptr)
+        {
+            worker->deque.add_rear(task);
+        }
+        else
+        {
+            lock_guard<mutex> guard(injectLock);
+            injectQueue.push_back(task);
+            injectCount.fetch_add(1);
+        }
+
+        // 잠들기 직전의 작업자와 엇갈리지 않도록, 작업을 넣은 뒤 sleepers 를
+        // 확인합니다. (잠드는 쪽은 sleepers 를 늘린 뒤 작업을 확인합니다)
+        atomic_thread_fence(memory_order_seq_cst);
+        if (sleepers.load(memory_order_relaxed) > 0)
+        {
+            lock_guard<mutex> guard(sleepLock);
+            sleepCv.notify_one();
+        }
+    }
+
+    // 작업 하나 실행 (작업자 스레드에서만 호출)
+    /*
+     * 자기 덱의 뒤쪽 -> 공용 대기열 -> 같은 노드의 작업자 -> 모든 작업자 순서로
+     * 작업을 찾습니다.
+     * @return 작업을 실행했는지 여부
+     */
+    bool run_one()
+    {
+        Worker *worker = current_worker();
+        Task *task = nullptr;
+
+        if (worker->deque.remove_rear(task))
+        {
+            task->execute(task);
+            return true;
+        }
+
+        if (injectCount.load(memory_order_relaxed) > 0)
+        {
+            lock_guard<mutex> guard(injectLock);
+            if (!injectQueue.empty())
+            {
+                task = injectQueue.front();
+                injectQueue.pop_front();
+                injectCount.fetch_sub(1);
+            }
+        }
+        if (task == nullptr)
+        {
+            task = steal(worker);
+        }
+
+        if (task == nullptr)
+        {
+            return false;
+        }
+        task->execute(task);
+        return true;
+    }
+
+    Task *steal(Worker *worker)
+    {
+        Task *task = nullptr;
+        uint32_t random = next_random(worker);
+
+        const vector<int> &victims = worker->localVictims;
+        for (size_t i = 0; i < victims.size(); i++)
+        {
+            if (workers[victims[(random + i) % victims.size()]]->deque.steal_front(task))
+            {
+                return task;
+            }
+        }
+
+        int count = worker_count();
+        for (int i = 0; i < count; i++)
+        {
+            Worker &victim = *workers[(random + i) % count];
+            if (&victim != worker && victim.deque.steal_front(task))
+            {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    uint32_t next_random(Worker *worker)
+    {
+        uint32_t &state = worker->randomState;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    bool has_work()
+    {
+        if (injectCount.load(memory_order_relaxed) > 0)
+        {
+            return true;
+        }
+        for (auto &worker : workers)
+        {
+            if (worker->deque.size_approx() > 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 작업자 스레드
+    /*
+     * 작업을 찾지 못하면 잠시 양보하며 다시 찾다가, SPIN_COUNT 번 연속으로
+     * 실패하면 새 작업이 제출될 때까지 잠듭니다.
+     */
+    void worker_loop(Worker &worker)
+    {
+        thread_worker() = &worker;
+        pin_to_cpu(worker.cpu);
+
+        int idle = 0;
+        while (!stopping.load(memory_order_relaxed))
+        {
+            if (run_one())
+            {
+                idle = 0;
+                continue;
+            }
+
+            if (++idle < SPIN_COUNT)
+            {
+                this_thread::yield();
+                continue;
+            }
+
+            unique_lock<mutex> guard(sleepLock);
+            sleepers.fetch_add(1);
+            atomic_thread_fence(memory_order_seq_cst);
+            if (!stopping.load() && !has_work())
+            {
+                sleepCv.wait(guard);
+            }
+            sleepers.fetch_sub(1);
+            idle = 0;
+        }
+    }
+
+    static void pin_to_cpu(int cpu)
+    {
+#ifdef __linux__
+        if (cpu < 0)
+        {
+            return;
+        }
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void)cpu;
+#endif
+    }
+
+    // NUMA 노드별 CPU 목록
+    /*
+     * /sys/devices/system/node/nodeN/cpulist ("0-3,8-11" 형식)를 읽고, 이
+     * 프로세스가 사용할 수 있는 CPU 만 남깁니다. 읽을 수 없으면 사용할 수 있는
+     * CPU 전체를 하나의 노드로 봅니다.
+     */
+    static vector<vector<int>> read_numa_nodes()
+    {
+        vector<vector<int>> nodes;
+#ifdef __linux__
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+        {
+            return nodes;
+        }
+
+        for (int n = 0; n < 1024; n++)
+        {
+            ifstream file("/sys/devices/system/node/node" + to_string(n) + "/cpulist");
+            if (!file)
+            {
+                if (n > 0 && nodes.empty())
+                {
+                    break;
+                }
+                continue;
+            }
+
+            string text;
+            getline(file, text);
+            vector<int> cpus;
+            for (int cpu : parse_cpu_list(text))
+            {
+                if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))
+                {
+                    cpus.push_back(cpu);
+                }
+            }
+            if (!cpus.empty())
+            {
+                nodes.push_back(cpus);
+            }
+        }
+
+        if (nodes.empty())
+        {
+            vector<int> cpus;
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            {
+                if (CPU_ISSET(cpu, &allowed))
+                {
+                    cpus.push_back(cpu);
+                }
+            }
+            nodes.push_back(cpus);
+        }
+#endif
+        return nodes;
+    }
+
+    static vector<int> parse_cpu_list(const string &text)
+    {
+        vector<int> cpus;
+        stringstream stream(text);
+        string range;
+        while (getline(stream, range, ','))
+        {
+            if (range.empty())
+            {
+                continue;
+            }
+            size_t dash = range.find('-');
+            int first = stoi(range.substr(0, dash));
+            int last = dash == string::npos ? first : stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; cpu++)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+    }
+};
+
+template <typename F>
+void TaskGroup::spawn(F f)
+{
+    pending.fetch_add(1, memory_order_relaxed);
+    pool.submit(new ClosureTask<F>(move(f), this));
+}
+
+void TaskGroup::sync()
+{
+    // 작업자가 아닌 스레드는 작업을 처리하지 않고 끝날 때까지 양보하며 기다립니다.
+    bool helping = pool.current_worker() != nullptr;
+    int idle = 0;
+    while (pending.load(memory_order_acquire) > 0)
+    {
+        if (helping && pool.run_one())
+        {
+            idle = 0;
+        }
+        else if (!helping || ++idle > 16)
+        {
+            this_thread::yield();
+        }
+    }
+}
+
+/*
+ * ---------------------------------------------------------------------------
+ * 병렬 병합 정렬
+ * ---------------------------------------------------------------------------
+ */
+
+const int SORT_CUTOFF = 1 << 13;  // 이보다 작은 구간은 순차 정렬
+const int MERGE_CUTOFF = 1 << 14; // 이보다 작은 병합은 순차 병합
+
+// 순차 병합 정렬 (MergeSort.cpp 와 같은 구조)
+void asc_merge(int arr[], int left, int mid, int right)
+{
+    int leftSize = mid - left + 1;
+    int rightSize = right - mid;
+
+    int *leftArr = new int[leftSize];
+    int *rightArr = new int[rightSize];
+
+    for (int i = 0; i < leftSize; i++)
+    {
+        leftArr[i] = arr[left + i];
+    }
+    for (int i = 0; i < rightSize; i++)
+    {
+        rightArr[i] = arr[mid + i + 1];
+    }
+
+    int i = 0;
+    int j = 0;
+    int k = left;
+
+    while (i < leftSize && j < rightSize)
+    {
+        if (leftArr[i] <= rightArr[j])
+        {
+            arr[k++] = leftArr[i++];
+        }
+        else
+        {
+            arr[k++] = rightArr[j++];
+        }
+    }
+
+    while (i < leftSize)
+    {
+        arr[k++] = leftArr[i++];
+    }
+
+    while (j < rightSize)
+    {
+        arr[k++] = rightArr[j++];
+    }
+
+    delete[] leftArr;
+    delete[] rightArr;
+}
+
+void asc_merge_sort(int arr[], int left, int right)
+{
+    if (left < right)
+    {
+        int mid = left + (right - left) / 2;
+
+        asc_merge_sort(arr, left, mid);
+        asc_merge_sort(arr, mid + 1, right);
+
+        asc_merge(arr, left, mid, right);
+    }
+}
+
+/**
+ * 정렬된 두 구간 src[l1..r1], src[l2..r2] 를 dst[d..] 에 병렬로 병합하는 함수
+ *
+ * 더 긴 구간의 가운데 값 x 를 고르고 다른 구간에서 x 가 들어갈 위치를 이진
+ * 탐색으로 찾으면, x 의 최종 위치가 정해지고 나머지는 x 의 왼쪽끼리, 오른쪽끼리
+ * 독립적으로 병합할 수 있습니다. 같은 값은 첫 번째 구간의 요소가 앞에 오도록
+ * 찾으므로 안정 정렬이 유지됩니다.
+ */
+void parallel_merge(ForkJoinPool &pool, const int src[], int l1, int r1, int l2, int r2, int dst[], int d)
+{
+    int n1 = r1 - l1 + 1;
+    int n2 = r2 - l2 + 1;
+
+    if (n1 + n2 <= MERGE_CUTOFF)
+    {
+        int i = l1;
+        int j = l2;
+        while (i <= r1 && j <= r2)
+        {
+            dst[d++] = src[i] <= src[j] ? src[i++] : src[j++];
+        }
+        while (i <= r1)
+        {
+            dst[d++] = src[i++];
+        }
+        while (j <= r2)
+        {
+            dst[d++] = src[j++];
+        }
+        return;
+    }
+
+    int m1, m2, pos;
+    TaskGroup group(pool);
+    if (n1 >= n2)
+    {
+        // 두 번째 구간에서 x 보다 작은 값만 x 앞에 옵니다.
+        m1 = l1 + n1 / 2;
+        m2 = static_cast<int>(lower_bound(src + l2, src + r2 + 1, src[m1]) - src);
+        pos = d + (m1 - l1) + (m2 - l2);
+        dst[pos] = src[m1];
+
+        group.spawn([&pool, src, l1, m1, l2, m2, dst, d]
+            {
+                parallel_merge(pool, src, l1, m1 - 1, l2, m2 - 1, dst, d);
+            });
+        parallel_merge(pool, src, m1 + 1, r1, m2, r2, dst, pos + 1);
+    }
+    else
+    {
+        // 첫 번째 구간에서 x 보다 작거나 같은 값이 x 앞에 옵니다.
+        m2 = l2 + n2 / 2;
+        m1 = static_cast<int>(upper_bound(src + l1, src + r1 + 1, src[m2]) - src);
+        pos = d + (m1 - l1) + (m2 - l2);
+        dst[pos] = src[m2];
+
+        group.spawn([&pool, src, l1, m1, l2, m2, dst, d]
+            {
+                parallel_merge(pool, src, l1, m1 - 1, l2, m2 - 1, dst, d);
+            });
+        parallel_merge(pool, src, m1, r1, m2 + 1, r2, dst, pos + 1);
+    }
+    group.sync();
+}
+
+void parallel_merge_sort_task(ForkJoinPool &pool, int arr[], int tmp[], int left, int right)
+{
+    if (right - left + 1 <= SORT_CUTOFF)
+    {
+        asc_merge_sort(arr, left, right);
+        return;
+    }
+
+    int mid = left + (right - left) / 2;
+
+    // 왼쪽은 다른 작업자가 가져갈 수 있도록 spawn 하고, 오른쪽은 직접 정렬합니다.
+    TaskGroup group(pool);
+    group.spawn([&pool, arr, tmp, left, mid] { parallel_merge_sort_task(pool, arr, tmp, left, mid); });
+    parallel_merge_sort_task(pool, arr, tmp, mid + 1, right);
+    group.sync();
+
+    parallel_merge(pool, arr, left, mid, mid + 1, right, tmp, left);
+    pool.parallel_for(left, right + 1, [arr, tmp](int i) { arr[i] = tmp[i]; });
+}
+
+/**
+ * 오름차순 병렬 병합 정렬 함수
+ * @param pool 작업을 처리할 스레드 풀
+ * @param arr 정렬할 배열
+ * @param left 왼쪽 인덱스
+ * @param right 오른쪽 인덱스
+ */
+void asc_parallel_merge_sort(ForkJoinPool &pool, int arr[], int left, int right)
+{
+    if (left >= right)
+    {
+        return;
+    }
+
+    vector<int> tmp(right + 1);
+    pool.run([&] { parallel_merge_sort_task(pool, arr, tmp.data(), left, right); });
+}
+
+/*
+ * ---------------------------------------------------------------------------
+ * 병렬 퀵 정렬
+ * ---------------------------------------------------------------------------
+ */
+
+// 순차 퀵 정렬 (QuickSort.cpp 와 같은 구조)
+int partition(int arr[], int low, int high)
+{
+    int pivot = arr[high];
+    int i = low - 1;
+
+    for (int j = low; j < high; j++)
+    {
+        if (arr[j] <= pivot)
+        {
+            i++;
+            swap(arr[i], arr[j]);
+        }
+    }
+
+    swap(arr[i + 1], arr[high]);
+    return i + 1;
+}
+
+void asc_quick_sort(int arr[], int low, int high)
+{
+    if (low < high)
+    {
+        int pivot_index = partition(arr, low, high);
+
+        asc_quick_sort(arr, low, pivot_index - 1);
+        asc_quick_sort(arr, pivot_index + 1, high);
+    }
+}
+
+void parallel_quick_sort_task(ForkJoinPool &pool, int arr[], int low, int high)
+{
+    if (high - low + 1 <= SORT_CUTOFF)
+    {
+        asc_quick_sort(arr, low, high);
+        return;
+    }
+
+    int pivot_index = partition(arr, low, high);
+
+    TaskGroup group(pool);
+    group.spawn([&pool, arr, low, pivot_index] { parallel_quick_sort_task(pool, arr, low, pivot_index - 1); });
+    parallel_quick_sort_task(pool, arr, pivot_index + 1, high);
+    group.sync();
+}
+
+/**
+ * 오름차순 병렬 퀵 정렬 함수
+ *
+ * 분할(partition)은 순차로 수행하고, 분할된 두 부분을 병렬로 정렬합니다.
+ * 첫 분할이 O(N)이므로 작업자가 많아도 속도 향상은 분할 단계에서 제한됩니다.
+ * @param pool 작업을 처리할 스레드 풀
+ * @param arr 정렬할 배열
+ * @param low 시작 인덱스
+ * @param high 끝 인덱스
+ */
+void asc_parallel_quick_sort(ForkJoinPool &pool, int arr[], int low, int high)
+{
+    pool.run([&] { parallel_quick_sort_task(pool, arr, low, high); });
+}
+
+/*
+ * ---------------------------------------------------------------------------
+ * 병렬 너비 우선 탐색
+ * ---------------------------------------------------------------------------
+ */
+
+// 순차 BFS (BreathFirstSearch.cpp 와 같은 구조)
+vector<int> bfs_from_source(const vector<vector<int>> &graph, int start_node)
+{
+    vector<int> path;
+    int vertex_size = graph.size();
+
+    vector<bool> visited(vertex_size, false);
+    visited[start_node] = true;
+
+    queue<int> node_to_visit;
+    node_to_visit.push(start_node);
+
+    while (!node_to_visit.empty())
+    {
+        int current_node = node_to_visit.front();
+        node_to_visit.pop();
+
+        path.push_back(current_node);
+
+        for (int neighbor_node : graph[current_node])
+        {
+            if (!visited[neighbor_node])
+            {
+                visited[neighbor_node] = true;
+                node_to_visit.push(neighbor_node);
+            }
+        }
+    }
+
+    return path;
+}
+
+/**
+ * 시작점이 주어진 병렬 BFS (단계별 동기화)
+ *
+ * 같은 거리(단계)의 정점들을 병렬로 처리하고, 단계가 끝날 때마다 다음 단계의
+ * 정점 목록을 만듭니다. 순차 BFS 와 같은 방문 순서를 얻기 위해 한 단계를 세
+ * 번에 나눠 처리합니다.
+ * 1. 각 이웃 정점을, 그 정점을 가리키는 현재 단계 정점 중 순서가 가장 앞선
+ *    정점(부모)이 차지합니다. (CAS 로 더 작은 번호만 남깁니다)
+ * 2. 부모마다 자신이 차지한 이웃의 수를 셉니다.
+ * 3. 누적 합으로 구한 위치에 부모 순서, 인접 리스트 순서대로 이웃을 씁니다.
+ * @param pool 작업을 처리할 스레드 풀
+ * @param graph 탐색할 인접 리스트 그래프
+ * @param start_node 탐색 시작 노드
+ * @return 탐색 경로 (bfs_from_source 와 같습니다)
+ */
+vector<int> parallel_bfs_from_source(ForkJoinPool &pool, const vector<vector<int>> &graph, int start_node)
+{
+    const int UNCLAIMED = INT_MAX;
+    const int VISITED = -1;
+
+    int vertex_size = graph.size();
+
+    // 정점의 상태: UNCLAIMED, VISITED, 이번 단계의 부모 번호(>= 0),
+    // 또는 개수를 센 뒤의 표시 -(부모 번호 + 2)
+    vector<atomic<int>> owner(vertex_size);
+    pool.parallel_for(0, vertex_size, [&](int v) { owner[v].store(UNCLAIMED, memory_order_relaxed); });
+    owner[start_node].store(VISITED, memory_order_relaxed);
+
+    vector<int> path;
+    path.push_back(start_node);
+    vector<int> offsets;
+
+    size_t level_begin = 0;
+    while (level_begin < path.size())
+    {
+        size_t level_end = path.size();
+        int level_size = static_cast<int>(level_end - level_begin);
+        const int *frontier = path.data() + level_begin;
+
+        // 1. 이웃 정점 차지하기
+        pool.parallel_for(0, level_size, [&](int i)
+            {
+                for (int neighbor_node : graph[frontier[i]])
+                {
+                    int current = owner[neighbor_node].load(memory_order_relaxed);
+                    while (current > i &&
+                           !owner[neighbor_node].compare_exchange_weak(current, i, memory_order_relaxed))
+                    {
+                    }
+                }
+            });
+
+        // 2. 부모별로 차지한 이웃 세기 (중복 간선은 한 번만 셉니다)
+        offsets.assign(level_size + 1, 0);
+        pool.parallel_for(0, level_size, [&](int i)
+            {
+                int count = 0;
+                for (int neighbor_node : graph[frontier[i]])
+                {
+                    if (owner[neighbor_node].load(memory_order_relaxed) == i)
+                    {
+                        owner[neighbor_node].store(-(i + 2), memory_order_relaxed);
+                        count++;
+                    }
+                }
+                offsets[i + 1] = count;
+            });
+
+        for (int i = 0; i < level_size; i++)
+        {
+            offsets[i + 1] += offsets[i];
+        }
+
+        // 3. 다음 단계의 정점 쓰기
+        path.resize(level_end + offsets[level_size]);
+        frontier = path.data() + level_begin;
+        int *next = path.data() + level_end;
+        pool.parallel_for(0, level_size, [&](int i)
+            {
+                int position = offsets[i];
+                for (int neighbor_node : graph[frontier[i]])
+                {
+                    if (owner[neighbor_node].load(memory_order_relaxed) == -(i + 2))
+                    {
+                        owner[neighbor_node].store(VISITED, memory_order_relaxed);
+                        next[position++] = neighbor_node;
+                    }
+                }
+            });
+
+        level_begin = level_end;
+    }
+
+    return path;
+}
+
+/**
+ * 배열 출력 함수
+ */
+void print_array(const int arr[], const int size)
+{
+    for (int i = 0; i < size; i++)
+    {
+        cout << arr[i] << " ";
+    }
+    cout << endl;
+}
+
+template <typename F>
+double measure_ms(F f)
+{
+    auto start = chrono::steady_clock::now();
+    f();
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main()
+{
+    ForkJoinPool pool;
+
+    cout << "작업자 " << pool.worker_count() << "개, NUMA 노드 " << pool.node_count() << "개" << endl;
+
+    int arr[] = {64, 25, 12, 22, 11};
+    int size = sizeof(arr) / sizeof(arr[0]);
+
+    cout << "\n정렬 전: ";
+    print_array(arr, size);
+    asc_parallel_merge_sort(pool, arr, 0, size - 1);
+    cout << "병렬 병합 정렬 후: ";
+    print_array(arr, size);
+
+    vector<vector<int>> graph =
+    {
+        {1, 2},     // 0
+        {0, 3, 4},  // 1
+        {0, 5, 6},  // 2
+        {1},        // 3
+        {1},        // 4
+        {2},        // 5
+        {2}         // 6
+    };
+    cout << "\n병렬 BFS 탐색: ";
+    vector<int> path = parallel_bfs_from_source(pool, graph, 3);
+    print_array(path.data(), static_cast<int>(path.size()));
+
+    // 벤치마크
+    /*
+     * 순차 버전과 병렬 버전의 시간을 비교하고 결과가 같은지 확인합니다.
+     * 코어가 하나뿐인 환경에서는 속도 향상이 나타나지 않습니다.
+     */
+    const int N = 10000000;
+    const int V = 2000000;
+    const int DEGREE = 4;
+    mt19937 rng(42);
+
+    vector<int> data(N);
+    for (int &value : data)
+    {
+        value = static_cast<int>(rng() >> 1);
+    }
+    vector<int> expected = data;
+    sort(expected.begin(), expected.end());
+
+    cout << "\n[정수 " << N << "개 정렬, 작업자 " << pool.worker_count() << "개]\n";
+    {
+        vector<int> a = data;
+        vector<int> b = data;
+        double sequential = measure_ms([&] { asc_merge_sort(a.data(), 0, N - 1); });
+        double parallel = measure_ms([&] { asc_parallel_merge_sort(pool, b.data(), 0, N - 1); });
+        cout << "병합 정렬 - 순차: " << sequential << "ms, 병렬: " << parallel << "ms ("
+             << (a == expected && b == expected ? "결과 일치" : "결과 불일치") << ")\n";
+    }
+    {
+        vector<int> a = data;
+        vector<int> b = data;
+        double sequential = measure_ms([&] { asc_quick_sort(a.data(), 0, N - 1); });
+        double parallel = measure_ms([&] { asc_parallel_quick_sort(pool, b.data(), 0, N - 1); });
+        cout << "퀵 정렬   - 순차: " << sequential << "ms, 병렬: " << parallel << "ms ("
+             << (a == expected && b == expected ? "결과 일치" : "결과 불일치") << ")\n";
+    }
+
+    // 무작위 무방향 그래프 (정점당 평균 간선 2 * DEGREE 개)
+    vector<vector<int>> random_graph(V);
+    for (int v = 0; v < V; v++)
+    {
+        for (int e = 0; e < DEGREE; e++)
+        {
+            int u = static_cast<int>(rng() % V);
+            random_graph[v].push_back(u);
+            random_graph[u].push_back(v);
+        }
+    }
+
+    cout << "\n[정점 " << V << "개 그래프 BFS]\n";
+    {
+        vector<int> a, b;
+        double sequential = measure_ms([&] { a = bfs_from_source(random_graph, 0); });
+        double parallel = measure_ms([&] { b = parallel_bfs_from_source(pool, random_graph, 0); });
+        cout << "BFS - 순차: " << sequential << "ms, 병렬: " << parallel << "ms (방문 " << b.size() << "개, "
+             << (a == b ? "방문 순서 일치" : "방문 순서 불일치") << ")\n";
+    }
+
+    return 0;
+}
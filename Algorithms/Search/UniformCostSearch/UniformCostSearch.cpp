@@ -12,12 +12,21 @@
  * 있지만, 상태 공간이 많아지면 우선순위 큐의 크기가 커져 성능이 저하될 수
  * 있습니다.
  *
+ * 꺼내는 비용이 감소하지 않으므로(monotone), 비교 기반 이진 힙 대신
+ * 기수 힙(radix heap)을 우선순위 큐로 사용할 수 있습니다. ucs 는 큐 구현을
+ * 템플릿 인자로 받으며, 기본값은 std::priority_queue 입니다.
+ *
  */
 
 #include <iostream>
 #include <vector>
 #include <queue>
 #include <deque>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <chrono>
+#include <stdexcept>
 
 using namespace std;
 
@@ -32,22 +41,183 @@ struct second_comparion
     }
 };
 
+// std::priority_queue 기반 큐 (비용이 작을수록 우선순위가 높음)
+class BinaryHeapQueue
+{
+    priority_queue<
+        pair<int, int>,         // (현재 노드, 누적 비용)
+        vector<pair<int, int>>, // 내부 컨테이너로
+        second_comparion>       // 오름차순으로 설정
+        pq;
+
+public:
+    void enqueue(int node, int cost)
+    {
+        pq.push({node, cost});
+    }
+
+    void dequeue()
+    {
+        pq.pop();
+    }
+
+    int peek() const
+    {
+        return pq.top().first;
+    }
+
+    int peek_priority() const
+    {
+        return pq.top().second;
+    }
+
+    bool is_empty() const
+    {
+        return pq.empty();
+    }
+};
+
+// 기수 힙 기반 큐 (RadixHeapPriorityQueue.cpp 와 같은 구조)
+/*
+ * 마지막으로 꺼낸 비용과 처음으로 달라지는 비트의 위치로 버킷을 정합니다.
+ * 삽입은 O(1), 삭제는 분할 상환 O(32) 입니다.
+ */
+class RadixHeapQueue
+{
+    static constexpr int BUCKET_COUNT = 33;
+
+    vector<pair<uint32_t, int>> buckets[BUCKET_COUNT]; // (누적 비용, 노드)
+    uint32_t last = 0;
+    size_t count = 0;
+
+    int minBucket = -1;
+    size_t minIndex = 0;
+
+public:
+    void enqueue(int node, int cost)
+    {
+        if ((uint32_t)cost < last)
+        {
+            throw runtime_error("Priority is smaller than the last dequeued priority");
+        }
+
+        int index = bucket_index(cost);
+        buckets[index].emplace_back(cost, node);
+        count++;
+
+        if (index <= minBucket)
+        {
+            minBucket = -1;
+        }
+    }
+
+    void dequeue()
+    {
+        if (buckets[0].empty())
+        {
+            pull();
+        }
+        buckets[0].pop_back();
+        count--;
+    }
+
+    int peek()
+    {
+        return front().second;
+    }
+
+    int peek_priority()
+    {
+        return front().first;
+    }
+
+    bool is_empty() const
+    {
+        return count == 0;
+    }
+
+private:
+    const pair<uint32_t, int> &front()
+    {
+        if (!buckets[0].empty())
+        {
+            return buckets[0].back();
+        }
+
+        find_min();
+        return buckets[minBucket][minIndex];
+    }
+
+    int bucket_index(uint32_t key) const
+    {
+        uint32_t diff = key ^ last;
+        int width = 0;
+#if defined(__GNUC__) || defined(__clang__)
+        width = diff == 0 ? 0 : 32 - __builtin_clz(diff);
+#else
+        for (; diff; diff >>= 1)
+        {
+            width++;
+        }
+#endif
+        return width;
+    }
+
+    void find_min()
+    {
+        if (minBucket != -1)
+        {
+            return;
+        }
+
+        int i = 1;
+        while (buckets[i].empty())
+        {
+            i++;
+        }
+
+        minBucket = i;
+        minIndex = 0;
+        for (size_t j = 1; j < buckets[i].size(); j++)
+        {
+            if (buckets[i][j].first < buckets[i][minIndex].first)
+            {
+                minIndex = j;
+            }
+        }
+    }
+
+    // 최소 비용을 새 기준으로 삼아 해당 버킷의 요소들을 더 낮은 버킷으로 옮깁니다.
+    void pull()
+    {
+        find_min();
+        int i = minBucket;
+        last = buckets[i][minIndex].first;
+        minBucket = -1;
+
+        swap(buckets[i][minIndex], buckets[i].back());
+        for (auto &item : buckets[i])
+        {
+            buckets[bucket_index(item.first)].push_back(item);
+        }
+        buckets[i].clear();
+    }
+};
+
 /**
  * 균일 비용 탐색 
+ * @tparam Queue 우선순위 큐 구현 (BinaryHeapQueue 또는 RadixHeapQueue)
  * @param graph 가중치 그래프 (인접 리스트)
  * @param start 시작 노드
  * @param goal 목표 노드
  * @param path 탐색 경로
  * @return 목표 노드를 찾으면 true, 아니면 false
  */
+template <typename Queue = BinaryHeapQueue>
 int ucs(vector<vector<pair<int, int>>> &graph, int start,
                         int goal, deque<int> &path)
 {
-    priority_queue<
-        pair<int, int>,         // (현재 노드, 누적 비용)
-        vector<pair<int, int>>, // 내부 컨테이너로
-        second_comparion>       // 오름차순으로 설정
-        pq;
+    Queue pq;
 
     // 시작점에서 각 노드까지의 최소 비용
     vector<int> cost(graph.size(), INT_MAX);
@@ -55,13 +225,20 @@ int ucs(vector<vector<pair<int, int>>> &graph, int start,
     vector<int> parent(graph.size(), -1);
 
     // 시작 노드 등록
-    pq.push({start, 0});
+    pq.enqueue(start, 0);
     cost[start] = 0;
 
-    while (!pq.empty())
+    while (!pq.is_empty())
     {
-        auto [node, cur_cost] = pq.top();
-        pq.pop();
+        int node = pq.peek();
+        int cur_cost = pq.peek_priority();
+        pq.dequeue();
+
+        // 이미 더 짧은 경로로 방문한 노드
+        if (cur_cost > cost[node])
+        {
+            continue;
+        }
 
         // 목표 노드 도착 시 종료
         if (node == goal)
@@ -85,7 +262,7 @@ int ucs(vector<vector<pair<int, int>>> &graph, int start,
             {
                 cost[neighbor] = new_cost;
                 parent[neighbor] = node;
-                pq.push({neighbor, new_cost});
+                pq.enqueue(neighbor, new_cost);
             }
         }
     }
@@ -94,6 +271,58 @@ int ucs(vector<vector<pair<int, int>>> &graph, int start,
     return -1;
 }
 
+// 도로망과 비슷한 무작위 그래프
+/*
+ * width x height 격자에서 이웃한 교차로끼리 양방향 도로로 연결합니다.
+ * 도로의 비용(길이)은 10~100 사이의 무작위 값이며, 약 10%의 도로는 끊겨 있어
+ * 경로가 격자를 그대로 따르지 않습니다.
+ */
+vector<vector<pair<int, int>>> make_road_graph(int width, int height, unsigned seed)
+{
+    mt19937 rng(seed);
+    vector<vector<pair<int, int>>> graph(width * height);
+
+    auto connect = [&](int a, int b)
+    {
+        if (rng() % 10 == 0)
+        {
+            return;
+        }
+        int weight = 10 + rng() % 91;
+        graph[a].push_back({b, weight});
+        graph[b].push_back({a, weight});
+    };
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int node = y * width + x;
+            if (x + 1 < width)
+            {
+                connect(node, node + 1);
+            }
+            if (y + 1 < height)
+            {
+                connect(node, node + width);
+            }
+        }
+    }
+
+    return graph;
+}
+
+// ucs 한 번의 실행 시간(밀리초)을 측정합니다.
+template <typename Queue>
+double measure_ucs_ms(vector<vector<pair<int, int>>> &graph, int start, int goal, int &cost)
+{
+    deque<int> path;
+    auto begin = chrono::steady_clock::now();
+    cost = ucs<Queue>(graph, start, goal, path);
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - begin;
+    return elapsed.count();
+}
+
 int main()
 {
     //       0
@@ -136,7 +365,26 @@ int main()
         }
         cout << "\n";
     }
-    
+
+    // 벤치마크
+    /*
+     * 도로망과 비슷한 격자 그래프에서 한쪽 모서리에서 반대쪽 모서리까지의
+     * 최단 경로를 두 가지 우선순위 큐로 탐색합니다.
+     */
+    int sizes[] = {256, 1024, 2048};
+    for (int side : sizes)
+    {
+        vector<vector<pair<int, int>>> road = make_road_graph(side, side, side);
+        int goal = side * side - 1;
+
+        int heap_cost, radix_cost;
+        double heap_ms = measure_ucs_ms<BinaryHeapQueue>(road, 0, goal, heap_cost);
+        double radix_ms = measure_ucs_ms<RadixHeapQueue>(road, 0, goal, radix_cost);
+
+        cout << "[도로망 " << side << "x" << side << " (노드 " << side * side << "개)]\n";
+        cout << "  std::priority_queue - " << heap_ms << "ms (비용 " << heap_cost << ")\n";
+        cout << "  Radix heap          - " << radix_ms << "ms (비용 " << radix_cost << ")\n";
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -10,29 +10,220 @@
  * 리해싱 시 전체 데이터를 재처리해야 하므로 일시적인 성능 저하가 발생할 수
  * 있습니다.
  *
+ * 점진적 리해싱(incremental rehashing) 모드를 사용하면 기존 테이블과 새
+ * 테이블을 함께 유지하면서 매 연산마다 정해진 수의 버킷만 옮깁니다.
+ * 한 번의 삽입이 감당하는 작업량이 일정하게 제한되어 지연 시간의 급증을
+ * 막을 수 있습니다. 버킷 배열은 CHUNK_SIZE개 단위의 조각으로 나눠, 조각은
+ * 처음 쓸 때 만들고 옮기기가 끝나면 바로 해제하므로 새 테이블을 할당하거나
+ * 이전 테이블을 해제하는 비용도 한 연산에 몰리지 않습니다.
+ *
+ * 삭제로 부하율이 MIN_LOAD_FACTOR 아래로 떨어지면 테이블을 절반으로
+ * 줄입니다. 늘리는 기준(0.5)과 줄이는 기준(0.125) 사이에 간격을 두어
+ * 경계 근처에서 삽입과 삭제가 반복되어도 크기 조정이 반복되지 않습니다.
+ * 요소 수를 미리 알고 있다면 reserve()로 필요한 버킷을 한 번에 확보해
+ * 대량 삽입 중 리해싱을 피할 수 있습니다.
+ *
+ * get_stats()는 체인 길이 분포, 리해싱 횟수와 누적 시간, 요소당 메모리
+ * 사용량 등을 반환해 성능 저하의 원인이 해시 분포인지 테이블 구조인지
+ * 구분할 수 있게 합니다. HASH_COUNT_PROBES 를 정의하고 컴파일하면
+ * 탐색당 비교 횟수도 함께 집계합니다. (예: g++ -DHASH_COUNT_PROBES)
+ *
  */
 
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <chrono>
+#include <random>
+#include <memory>
 
 using namespace std;
 
+// 해시 테이블 통계
+struct HashStats
+{
+    int bucketCount;
+    int numOfElements;
+    float loadFactor;
+
+    // chainLengthHistogram[k] = 길이가 k인 체인(버킷)의 수
+    vector<int> chainLengthHistogram;
+    int maxChainLength;
+
+    int rehashCount;
+    double rehashTimeMs;
+
+    // 삽입/삭제 한 번에서 옮긴 버킷과 키 수의 최댓값 (시간과 달리 실행
+    // 환경의 영향을 받지 않는 한 연산의 최대 리해싱 작업량)
+    int maxMigrationPerOp;
+
+    // 테이블 구조, 버킷 벡터, 키 저장 공간을 모두 포함한 요소당 바이트 수
+    double bytesPerElement;
+
+    // loadSampleInterval번의 삽입/삭제마다 기록한 부하율
+    vector<float> loadFactorHistory;
+    int loadSampleInterval;
+
+    // 탐색(삭제 포함) 한 번당 평균 키 비교 횟수 (HASH_COUNT_PROBES 미정의 시 -1)
+    double averageProbesPerLookup;
+};
+
+// 버킷 배열
+/*
+ * 버킷(체인)을 CHUNK_SIZE개씩 묶은 조각으로 나눠 저장합니다. 조각은 처음
+ * 쓸 때 만들어지며, 만들어지지 않은 조각의 버킷은 빈 체인으로 읽힙니다.
+ * 그래서 버킷 수가 많아도 배열을 만드는 비용은 조각 포인터 배열뿐입니다.
+ */
+class BucketArray
+{
+    static constexpr int CHUNK_SIZE = 1024;
+
+    int count;
+    vector<unique_ptr<vector<int>[]>> chunks;
+
+public:
+    explicit BucketArray(int count = 0) : count(count), chunks((count + CHUNK_SIZE - 1) / CHUNK_SIZE) {}
+
+    int size() const
+    {
+        return count;
+    }
+
+    // 쓰기용 접근: 조각이 없으면 만듭니다.
+    vector<int> &operator[](int index)
+    {
+        unique_ptr<vector<int>[]> &chunk = chunks[index / CHUNK_SIZE];
+        if (!chunk)
+        {
+            chunk.reset(new vector<int>[CHUNK_SIZE]);
+        }
+        return chunk[index % CHUNK_SIZE];
+    }
+
+    // 읽기용 접근: 조각이 없으면 빈 체인을 반환합니다.
+    const vector<int> &operator[](int index) const
+    {
+        static const vector<int> empty;
+        const unique_ptr<vector<int>[]> &chunk = chunks[index / CHUNK_SIZE];
+        return chunk ? chunk[index % CHUNK_SIZE] : empty;
+    }
+
+    // index번 버킷이 조각의 마지막 버킷이라면 그 조각을 해제합니다.
+    void release_chunk_ending_at(int index)
+    {
+        if ((index + 1) % CHUNK_SIZE == 0 || index + 1 == count)
+        {
+            chunks[index / CHUNK_SIZE].reset();
+        }
+    }
+
+    // 만들어진 조각의 체인들의 남는 용량을 해제합니다.
+    void shrink_chains()
+    {
+        for (auto &chunk : chunks)
+        {
+            for (int i = 0; chunk && i < CHUNK_SIZE; ++i)
+            {
+                chunk[i].shrink_to_fit();
+            }
+        }
+    }
+
+    // 조각 포인터 배열과 만들어진 조각이 차지하는 바이트 수 (키 저장 공간 제외)
+    size_t bytes() const
+    {
+        size_t total = chunks.capacity() * sizeof(chunks[0]);
+        for (const auto &chunk : chunks)
+        {
+            total += chunk ? CHUNK_SIZE * sizeof(vector<int>) : 0;
+        }
+        return total;
+    }
+};
+
 class Hash
 {
     // 해시테이블은 bucketCount개의 버킷을 가지고 있으며,
     // 각 버킷은 정수형 데이터를 저장할 수 있는 벡터입니다.
     int bucketCount;
-    vector<vector<int>> table;
+    BucketArray table;
 
     int numOfElements;
 
     static constexpr float MAX_LOAD_FACTOR = 0.5f;
+    static constexpr float MIN_LOAD_FACTOR = 0.125f;
+
+    // 생성 시 지정한 버킷 수보다 작게 줄이지 않습니다.
+    int minBucketCount;
+
+    // 점진적 리해싱 모드
+    /*
+     * 리해싱이 진행 중인 동안에는 이전 테이블(oldTable)이 유지되며,
+     * migrateIndex 이전의 버킷은 이미 새 테이블로 옮겨진 상태입니다.
+     * 연산마다 migrateBucketsPerOp개(최소 MIGRATE_BUCKETS_PER_OP개)의
+     * 버킷을 옮깁니다. 이 값은 리해싱을 시작할 때, 새 테이블의 부하율이
+     * MAX_LOAD_FACTOR에 도달할 만큼 삽입되기 전에 이동이 끝나도록 정합니다.
+     * (테이블을 줄이는 경우 새 테이블이 작아 더 많이 옮깁니다)
+     */
+    bool incremental;
+    BucketArray oldTable;
+    int oldBucketCount;
+    int migrateIndex;
+    int migrateBucketsPerOp;
+
+    static constexpr int MIGRATE_BUCKETS_PER_OP = 4;
+
+    // 통계
+    /*
+     * 부하율 기록이 MAX_LOAD_SAMPLES개에 도달하면 기록을 하나 건너
+     * 하나씩 버리고 기록 간격을 2배로 늘려 메모리 사용량을 일정하게
+     * 유지합니다.
+     */
+    int rehashCount;
+    long long rehashTimeNs;
+    int migrationThisOp;
+    int maxMigrationPerOp;
+    vector<float> loadFactorHistory;
+    int loadSampleInterval;
+    int opsSinceSample;
+
+    static constexpr int MAX_LOAD_SAMPLES = 256;
+
+#ifdef HASH_COUNT_PROBES
+    mutable long long lookupCount = 0;
+    mutable long long probeCount = 0;
+#endif
+
+    // 생성부터 소멸까지 걸린 시간을 total에 더합니다.
+    struct ScopedTimer
+    {
+        long long &total;
+        chrono::steady_clock::time_point start;
+
+        ScopedTimer(long long &total) : total(total), start(chrono::steady_clock::now()) {}
+
+        ~ScopedTimer()
+        {
+            total += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+        }
+    };
 
 public:
-    Hash(int bucketCount) : bucketCount(bucketCount),
-                            table(bucketCount),
-                            numOfElements(0) {}
+    Hash(int bucketCount, bool incremental = false)
+        : bucketCount(bucketCount),
+          table(bucketCount),
+          numOfElements(0),
+          minBucketCount(bucketCount),
+          incremental(incremental),
+          oldBucketCount(0),
+          migrateIndex(0),
+          migrateBucketsPerOp(MIGRATE_BUCKETS_PER_OP),
+          rehashCount(0),
+          rehashTimeNs(0),
+          migrationThisOp(0),
+          maxMigrationPerOp(0),
+          loadSampleInterval(1),
+          opsSinceSample(0) {}
 
     // 해시 함수
     /*
@@ -47,11 +238,29 @@ public:
     /*
      * 주어진 키를 해시함수로 변환해 해당 버킷 벡터에 삽입합니다.
      * 이 때 부하율을 검사하고 리해싱을 진행합니다.
+     * 점진적 모드에서는 리해싱을 시작만 하고, 버킷 이동은 이후 연산들에
+     * 나누어 수행합니다.
      * 시간 복잡도: 평균 O(1), 최악 O(n)
+     *             (점진적 모드: 최악 O(migrateBucketsPerOp * 체인 길이))
      */
     void insert_item(int key)
     {
-        while (get_load_factor() > MAX_LOAD_FACTOR)
+        migrationThisOp = 0;
+
+        if (incremental)
+        {
+            migrate_step();
+
+            if (!is_rehashing() && get_load_factor() > MAX_LOAD_FACTOR)
+            {
+                {
+                    ScopedTimer timer(rehashTimeNs);
+                    start_rehashing(bucketCount * 2);
+                }
+                migrate_step();
+            }
+        }
+        else if (get_load_factor() > MAX_LOAD_FACTOR)
         {
             rehashing();
         }
@@ -59,23 +268,70 @@ public:
         int index = Hashing(key);
         table[index].push_back(key);
         numOfElements++;
+        record_load_sample();
+        record_migration();
     }
 
     // 삭제
     /*
      * 해당 키를 가진 버킷의 우치를 찾고 삭제합니다.
+     * 리해싱이 진행 중이라면 아직 옮겨지지 않은 이전 테이블도 확인합니다.
+     * 비게 된 버킷의 메모리는 바로 해제하며, 부하율이 MIN_LOAD_FACTOR
+     * 아래로 떨어지면 테이블을 절반으로 줄입니다.
      * 시간 복잡도: 평균 O(1), 최악 O(n)
      */
     void delete_item(int key)
     {
-        int index = Hashing(key);
-        auto &chain = table[index];
-        auto it = find(chain.begin(), chain.end(), key);
-        if (it != chain.end())
+        migrationThisOp = 0;
+        migrate_step();
+
+        if (erase_from(table[Hashing(key)], key))
+        {
+            numOfElements--;
+        }
+        else if (in_old_table(key) &&
+                 erase_from(oldTable[Hashing(key, oldBucketCount)], key))
         {
-            chain.erase(it);
             numOfElements--;
         }
+        record_load_sample();
+
+        if (!is_rehashing() && bucketCount / 2 >= minBucketCount &&
+            get_load_factor() < MIN_LOAD_FACTOR)
+        {
+            if (incremental)
+            {
+                {
+                    ScopedTimer timer(rehashTimeNs);
+                    start_rehashing(bucketCount / 2);
+                }
+                migrate_step();
+            }
+            else
+            {
+                resize(bucketCount / 2);
+            }
+        }
+        record_migration();
+    }
+
+    // 탐색
+    /*
+     * 키가 존재하면 true를 반환합니다. 리해싱이 진행 중이라면 두 테이블을
+     * 모두 확인합니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    bool find(int key) const
+    {
+        count_lookup();
+
+        if (chain_contains(table[Hashing(key)], key))
+        {
+            return true;
+        }
+
+        return in_old_table(key) &&
+               chain_contains(oldTable[Hashing(key, oldBucketCount)], key);
     }
 
     // 리해싱
@@ -87,28 +343,164 @@ public:
      */
     void rehashing()
     {
-        bucketCount *= 2;
-        vector<vector<int>> oldTable = table;
+        if (is_rehashing())
+        {
+            ScopedTimer timer(rehashTimeNs);
+            migrate_buckets(oldBucketCount);
+            return;
+        }
 
-        table.clear();
-        table.resize(bucketCount);
-        numOfElements = 0;
+        resize(bucketCount * 2);
+    }
 
-        for (const auto &table : oldTable)
+    // 공간 예약
+    /*
+     * count개의 요소를 리해싱 없이 담을 수 있도록 버킷 수를 미리
+     * 늘립니다. 이미 충분하다면 아무것도 하지 않습니다.
+     * 시간 복잡도: O(n + b)
+     */
+    void reserve(int count)
+    {
+        int needed = static_cast<int>(count / MAX_LOAD_FACTOR) + 1;
+        if (needed > bucketCount)
         {
-            for (int key : table)
-            {
-                insert_item(key);
-            }
+            resize(needed);
         }
     }
 
+    // 메모리 정리
+    /*
+     * 진행 중인 리해싱을 마치고, 현재 요소 수에 맞는 크기(부하율이
+     * MAX_LOAD_FACTOR를 넘지 않는 최소 크기)로 테이블을 다시 구성한 뒤
+     * 각 버킷 벡터의 남는 용량을 해제합니다.
+     * 시간 복잡도: O(n + b)
+     */
+    void shrink_to_fit()
+    {
+        int fitted = max(minBucketCount, static_cast<int>(numOfElements / MAX_LOAD_FACTOR) + 1);
+        if (fitted < bucketCount)
+        {
+            resize(fitted);
+        }
+        else
+        {
+            rehashing_finish();
+        }
+
+        table.shrink_chains();
+    }
+
+    // 리해싱 진행 여부
+    bool is_rehashing() const
+    {
+        return oldBucketCount > 0;
+    }
+
     // 부하율 계산
-    float get_load_factor()
+    float get_load_factor() const
     {
         return (float)numOfElements / bucketCount;
     }
 
+    // 통계
+    /*
+     * 모든 버킷을 순회하며 체인 길이 분포와 메모리 사용량을 계산합니다.
+     * 리해싱이 진행 중이라면 아직 옮겨지지 않은 이전 테이블의 버킷도
+     * 포함합니다.
+     * 시간 복잡도: O(n + b)
+     */
+    HashStats get_stats() const
+    {
+        HashStats stats;
+        stats.bucketCount = bucketCount;
+        stats.numOfElements = numOfElements;
+        stats.loadFactor = get_load_factor();
+        stats.maxChainLength = 0;
+        stats.rehashCount = rehashCount;
+        stats.rehashTimeMs = rehashTimeNs / 1e6;
+        stats.maxMigrationPerOp = maxMigrationPerOp;
+        stats.loadFactorHistory = loadFactorHistory;
+        stats.loadSampleInterval = loadSampleInterval;
+
+        size_t bytes = sizeof(*this) +
+                       table.bytes() +
+                       oldTable.bytes() +
+                       loadFactorHistory.capacity() * sizeof(float);
+
+        auto add_chain = [&](const vector<int> &chain)
+        {
+            int length = static_cast<int>(chain.size());
+            if (length >= (int)stats.chainLengthHistogram.size())
+            {
+                stats.chainLengthHistogram.resize(length + 1, 0);
+            }
+            stats.chainLengthHistogram[length]++;
+            stats.maxChainLength = max(stats.maxChainLength, length);
+            bytes += chain.capacity() * sizeof(int);
+        };
+
+        const BucketArray &buckets = table;
+        const BucketArray &oldBuckets = oldTable;
+        for (int i = 0; i < bucketCount; ++i)
+        {
+            add_chain(buckets[i]);
+        }
+        for (int i = migrateIndex; i < oldBucketCount; ++i)
+        {
+            add_chain(oldBuckets[i]);
+        }
+
+        stats.bytesPerElement = numOfElements > 0 ? (double)bytes / numOfElements : 0.0;
+
+#ifdef HASH_COUNT_PROBES
+        stats.averageProbesPerLookup = lookupCount > 0 ? (double)probeCount / lookupCount : 0.0;
+#else
+        stats.averageProbesPerLookup = -1.0;
+#endif
+
+        return stats;
+    }
+
+    // 통계 출력
+    void display_stats() const
+    {
+        HashStats stats = get_stats();
+
+        cout << "버킷 수: " << stats.bucketCount
+             << ", 요소 수: " << stats.numOfElements
+             << ", 부하율: " << stats.loadFactor << '\n';
+
+        cout << "체인 길이 분포:";
+        for (size_t length = 0; length < stats.chainLengthHistogram.size(); ++length)
+        {
+            if (stats.chainLengthHistogram[length] > 0)
+            {
+                cout << " [" << length << "]=" << stats.chainLengthHistogram[length];
+            }
+        }
+        cout << "\n최대 체인 길이: " << stats.maxChainLength << '\n';
+
+        cout << "리해싱 횟수: " << stats.rehashCount
+             << ", 누적 리해싱 시간: " << stats.rehashTimeMs << "ms"
+             << ", 연산당 최대 이동량: " << stats.maxMigrationPerOp << '\n';
+        cout << "요소당 바이트: " << stats.bytesPerElement << '\n';
+
+        // 기록이 많으면 최대 16개만 골고루 골라 출력합니다.
+        size_t samples = stats.loadFactorHistory.size();
+        size_t step = max<size_t>(1, (samples + 15) / 16);
+        cout << "부하율 기록(" << stats.loadSampleInterval * step << "회 간격):";
+        for (size_t i = 0; i < samples; i += step)
+        {
+            cout << ' ' << stats.loadFactorHistory[i];
+        }
+        cout << '\n';
+
+        if (stats.averageProbesPerLookup >= 0)
+        {
+            cout << "탐색당 평균 비교 횟수: " << stats.averageProbesPerLookup << '\n';
+        }
+    }
+
     // 출력
     /*
      * 모든 버킷을 순외하며 저장된 값을 출력합니다.
@@ -125,9 +517,231 @@ public:
             }
             cout << '\n';
         }
+
+        if (is_rehashing())
+        {
+            cout << "(이동 대기 중인 이전 테이블)\n";
+            for (int i = migrateIndex; i < oldBucketCount; ++i)
+            {
+                cout << i;
+                for (int val : oldTable[i])
+                {
+                    cout << " -> " << val;
+                }
+                cout << '\n';
+            }
+        }
+    }
+
+private:
+    int Hashing(int key, int count) const
+    {
+        return key % count;
+    }
+
+    // 리해싱 중이고 key가 속한 이전 테이블의 버킷이 아직 옮겨지지 않았는지
+    // 확인합니다. (옮겨진 버킷의 조각은 이미 해제되었을 수 있습니다)
+    bool in_old_table(int key) const
+    {
+        return is_rehashing() && Hashing(key, oldBucketCount) >= migrateIndex;
+    }
+
+    // 체인에 키가 있는지 확인합니다.
+    bool chain_contains(const vector<int> &chain, int key) const
+    {
+        auto it = std::find(chain.begin(), chain.end(), key);
+        count_probes(chain, it);
+        return it != chain.end();
+    }
+
+    // 체인에서 키를 찾아 삭제하고, 삭제했다면 true를 반환합니다.
+    // 체인이 비게 되면 버킷 벡터의 메모리도 해제합니다.
+    bool erase_from(vector<int> &chain, int key)
+    {
+        count_lookup();
+
+        auto it = std::find(chain.begin(), chain.end(), key);
+        count_probes(chain, it);
+        if (it == chain.end())
+        {
+            return false;
+        }
+
+        chain.erase(it);
+        if (chain.empty())
+        {
+            vector<int>().swap(chain);
+        }
+        return true;
+    }
+
+    // 탐색 횟수 집계 (HASH_COUNT_PROBES 정의 시에만 동작)
+    void count_lookup() const
+    {
+#ifdef HASH_COUNT_PROBES
+        lookupCount++;
+#endif
+    }
+
+    // 찾은 위치까지 비교한 키의 수를 집계합니다.
+    void count_probes(const vector<int> &chain, vector<int>::const_iterator it) const
+    {
+#ifdef HASH_COUNT_PROBES
+        probeCount += (it - chain.begin()) + (it != chain.end() ? 1 : 0);
+#else
+        (void)chain;
+        (void)it;
+#endif
+    }
+
+    // 부하율 기록
+    /*
+     * loadSampleInterval번의 삽입/삭제마다 부하율을 기록합니다.
+     */
+    void record_load_sample()
+    {
+        if (++opsSinceSample < loadSampleInterval)
+        {
+            return;
+        }
+
+        opsSinceSample = 0;
+        loadFactorHistory.push_back(get_load_factor());
+
+        if ((int)loadFactorHistory.size() == MAX_LOAD_SAMPLES)
+        {
+            for (int i = 0; i < MAX_LOAD_SAMPLES / 2; ++i)
+            {
+                loadFactorHistory[i] = loadFactorHistory[2 * i + 1];
+            }
+            loadFactorHistory.resize(MAX_LOAD_SAMPLES / 2);
+            loadSampleInterval *= 2;
+        }
+    }
+
+    // 이번 삽입/삭제에서 옮긴 버킷과 키 수로 최댓값을 갱신합니다.
+    void record_migration()
+    {
+        maxMigrationPerOp = max(maxMigrationPerOp, migrationThisOp);
+    }
+
+    // 크기 조정
+    /*
+     * 진행 중인 리해싱을 마친 뒤 newBucketCount개의 버킷으로 모든 키를
+     * 한 번에 옮깁니다.
+     * 시간 복잡도: O(n + b)
+     */
+    void resize(int newBucketCount)
+    {
+        ScopedTimer timer(rehashTimeNs);
+
+        migrate_buckets(oldBucketCount);
+        start_rehashing(newBucketCount);
+        migrate_buckets(oldBucketCount);
+    }
+
+    // 진행 중인 리해싱이 있다면 모두 마칩니다.
+    void rehashing_finish()
+    {
+        if (is_rehashing())
+        {
+            ScopedTimer timer(rehashTimeNs);
+            migrate_buckets(oldBucketCount);
+        }
+    }
+
+    // 리해싱 시작
+    /*
+     * 현재 테이블을 이전 테이블로 옮기고(복사 없이 이동), 버킷이
+     * newBucketCount개인 빈 테이블을 새로 만듭니다. 새 테이블은 조각
+     * 포인터 배열만 할당하며 조각은 처음 쓸 때 만들어집니다.
+     *
+     * 이동이 끝나기 전에 새 테이블의 부하율이 MAX_LOAD_FACTOR를 넘지
+     * 않도록, 남은 여유(headroom)만큼 삽입되는 동안 모든 버킷을 옮길 수
+     * 있는 migrateBucketsPerOp를 정합니다.
+     */
+    void start_rehashing(int newBucketCount)
+    {
+        rehashCount++;
+
+        oldTable = move(table);
+        oldBucketCount = bucketCount;
+        migrateIndex = 0;
+
+        bucketCount = newBucketCount;
+        table = BucketArray(bucketCount);
+
+        int headroom = max(1, static_cast<int>(MAX_LOAD_FACTOR * bucketCount) - numOfElements);
+        migrateBucketsPerOp = max(MIGRATE_BUCKETS_PER_OP, (oldBucketCount + headroom - 1) / headroom);
+    }
+
+    // 버킷 이동
+    /*
+     * 이전 테이블의 버킷을 최대 migrateBucketsPerOp개 새 테이블로
+     * 옮깁니다. 이동에 걸린 시간은 리해싱 시간에 누적됩니다.
+     * 시간 복잡도: O(migrateBucketsPerOp * 체인 길이)
+     */
+    void migrate_step()
+    {
+        if (!is_rehashing())
+        {
+            return;
+        }
+
+        ScopedTimer timer(rehashTimeNs);
+        migrate_buckets(migrateBucketsPerOp);
+    }
+
+    // 이전 테이블의 버킷을 최대 count개 옮깁니다.
+    /*
+     * 옮긴 버킷의 메모리는 즉시 해제하고, 조각의 버킷을 모두 옮기면 조각도
+     * 해제합니다. 모든 버킷을 옮기면 이전 테이블을 제거합니다.
+     */
+    void migrate_buckets(int count)
+    {
+        const BucketArray &source = oldTable;
+        int end = min(migrateIndex + count, oldBucketCount);
+        for (; migrateIndex < end; ++migrateIndex)
+        {
+            const vector<int> &chain = source[migrateIndex];
+            for (int key : chain)
+            {
+                table[Hashing(key)].push_back(key);
+            }
+            migrationThisOp += 1 + static_cast<int>(chain.size());
+            oldTable.release_chunk_ending_at(migrateIndex);
+        }
+
+        if (migrateIndex == oldBucketCount)
+        {
+            oldTable = BucketArray();
+            oldBucketCount = 0;
+            migrateIndex = 0;
+            migrateBucketsPerOp = MIGRATE_BUCKETS_PER_OP;
+        }
     }
 };
 
+// count개의 키를 삽입하며 가장 오래 걸린 삽입 한 번의 시간(마이크로초)을
+// 재고, 삽입 한 번에서 옮긴 버킷과 키 수의 최댓값을 maxMigration에 담습니다.
+long long measure_worst_insert(bool incremental, int count, int &maxMigration)
+{
+    Hash hash(7, incremental);
+    long long worst = 0;
+
+    for (int key = 0; key < count; ++key)
+    {
+        auto start = chrono::steady_clock::now();
+        hash.insert_item(key);
+        auto elapsed = chrono::steady_clock::now() - start;
+
+        worst = max(worst, (long long)chrono::duration_cast<chrono::microseconds>(elapsed).count());
+    }
+
+    maxMigration = hash.get_stats().maxMigrationPerOp;
+    return worst;
+}
+
 int main()
 {
     vector<int> keys = {15, 11, 27, 8, 12};
@@ -148,5 +762,83 @@ int main()
     cout << "\n리해싱 이후:\n";
     hash.display_hash();
 
+    // 점진적 리해싱: 두 테이블이 함께 유지되는 동안에도 탐색이 가능합니다.
+    Hash incremental(7, true);
+    for (int key : keys)
+    {
+        incremental.insert_item(key);
+    }
+
+    cout << "\n점진적 리해싱 진행 중:\n";
+    incremental.display_hash();
+    cout << "27 탐색: " << (incremental.find(27) ? "있음" : "없음") << '\n';
+
+    incremental.insert_item(33);
+    incremental.insert_item(45);
+    incremental.delete_item(8);
+
+    cout << "\n점진적 리해싱 이후:\n";
+    incremental.display_hash();
+
+    // 통계 (무작위 키 10만 개 삽입 후 10만 번 탐색)
+    mt19937 rng(42);
+    Hash large(7);
+    for (int i = 0; i < 100000; ++i)
+    {
+        large.insert_item(rng() % 1000000000);
+    }
+    for (int i = 0; i < 100000; ++i)
+    {
+        large.find(rng() % 1000000000);
+    }
+
+    cout << "\n[통계]\n";
+    large.display_stats();
+
+    // 요소 수를 미리 알고 있다면 reserve()로 리해싱 없이 대량 삽입합니다.
+    Hash bulk(7);
+    bulk.reserve(100000);
+    for (int i = 0; i < 100000; ++i)
+    {
+        bulk.insert_item(i);
+    }
+    cout << "\n[reserve 후 대량 삽입]\n";
+    bulk.display_stats();
+
+    // 대부분 삭제하면 부하율이 낮아지며 테이블이 줄어듭니다.
+    for (int i = 0; i < 99000; ++i)
+    {
+        bulk.delete_item(i);
+    }
+    cout << "\n[99% 삭제 후]\n";
+    bulk.display_stats();
+
+    bulk.shrink_to_fit();
+    cout << "\n[shrink_to_fit 후]\n";
+    bulk.display_stats();
+
+    // 가장 느린 삽입 한 번의 비교
+    /*
+     * 시간은 스케줄링이나 페이지 폴트의 영향을 받으므로, 최악의 경우가
+     * 제한되는지는 한 번의 삽입에서 옮긴 버킷과 키 수로 확인합니다.
+     * 점진적 리해싱은 키 수가 10배로 늘어도 이 값이 늘어나지 않습니다.
+     */
+    cout << "\n최악의 단일 삽입 (시간 / 옮긴 버킷과 키 수)\n";
+    int worstMigration[2][2];
+    for (int incrementalMode = 0; incrementalMode < 2; ++incrementalMode)
+    {
+        cout << (incrementalMode ? "점진적 리해싱:" : "일괄 리해싱:");
+        for (int sizeIndex = 0; sizeIndex < 2; ++sizeIndex)
+        {
+            int count = sizeIndex ? 1000000 : 100000;
+            long long worstUs = measure_worst_insert(incrementalMode, count, worstMigration[incrementalMode][sizeIndex]);
+            cout << "  키 " << count << "개 " << worstUs << "us / "
+                 << worstMigration[incrementalMode][sizeIndex];
+        }
+        cout << '\n';
+    }
+    cout << "점진적 리해싱의 최악 작업량이 키 수와 무관한가: "
+         << (worstMigration[1][1] <= worstMigration[1][0] ? "예" : "아니오") << '\n';
+
     return 0;
 }
\ No newline at end of file
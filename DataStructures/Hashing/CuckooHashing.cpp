@@ -0,0 +1,418 @@
+/**
+ * 버킷화된 쿠쿠 해싱(Bucketized Cuckoo Hashing)
+ *
+ * 두 개의 해시 함수로 각 키가 들어갈 수 있는 후보 버킷을 정확히 두 개로
+ * 제한합니다. 각 버킷은 키 4개를 담을 수 있으며(4-way), 탐색은 두 버킷과
+ * 작은 보조 저장소(stash)만 확인하면 되므로 최악의 경우에도 O(1)입니다.
+ *
+ * 버킷 하나는 32바이트로 정렬되어 캐시 라인 경계에 걸치지 않으므로,
+ * 한 번의 탐색은 최대 두 개의 캐시 라인만 읽습니다.
+ *
+ * 삽입 시 두 후보 버킷이 모두 가득 차 있다면 기존 키 하나를 쫓아내고
+ * (뻐꾸기가 남의 둥지에서 알을 밀어내듯) 쫓겨난 키를 그 키의 다른 후보
+ * 버킷으로 옮깁니다. 정해진 횟수 안에 자리를 찾지 못하면 stash에 보관하고,
+ * stash도 가득 차면 테이블을 키워 다시 구성합니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+using namespace std;
+
+class Hash
+{
+    static constexpr int SLOTS_PER_BUCKET = 4;
+    static constexpr int MAX_DISPLACEMENTS = 500;
+    static constexpr int STASH_SIZE = 4;
+    static constexpr float MAX_LOAD_FACTOR = 0.95f;
+
+    // 키 4개와 사용 중인 슬롯의 비트마스크
+    struct alignas(32) Bucket
+    {
+        int keys[SLOTS_PER_BUCKET];
+        uint32_t used;
+    };
+
+    int bucketCount; // 2의 거듭제곱
+    vector<Bucket> table;
+    vector<int> stash;
+
+    int numOfElements;
+    uint32_t randomState;
+
+public:
+    Hash(int bucketCount) : bucketCount(round_up_pow2(bucketCount)),
+                            table(this->bucketCount, Bucket{}),
+                            numOfElements(0),
+                            randomState(2463534242u) {}
+
+    // 해시 함수
+    /*
+     * 서로 다른 상수로 키를 섞어 두 개의 독립적인 후보 버킷을 구합니다.
+     */
+    int Hashing1(int key) const
+    {
+        uint64_t h = static_cast<uint32_t>(key) * 0x9E3779B97F4A7C15ull;
+        return static_cast<int>((h >> 32) & (bucketCount - 1));
+    }
+
+    int Hashing2(int key) const
+    {
+        uint64_t h = (static_cast<uint32_t>(key) ^ 0x5bd1e995u) * 0xC2B2AE3D27D4EB4Full;
+        return static_cast<int>((h >> 32) & (bucketCount - 1));
+    }
+
+    // 삽입
+    /*
+     * 이미 존재하는 키는 다시 삽입하지 않습니다.
+     * 시간 복잡도: 평균 O(1) (분할 상환), 리해싱 시 O(n)
+     */
+    void insert_item(int key)
+    {
+        if (find(key))
+        {
+            return;
+        }
+
+        if (numOfElements + 1 > MAX_LOAD_FACTOR * capacity())
+        {
+            rehashing({key});
+            return;
+        }
+
+        int homeless;
+        if (!place(key, homeless))
+        {
+            rehashing({homeless});
+            return;
+        }
+
+        numOfElements++;
+    }
+
+    // 삭제
+    /*
+     * 두 후보 버킷과 stash에서 키를 찾아 삭제합니다.
+     * 시간 복잡도: O(1)
+     */
+    void delete_item(int key)
+    {
+        for (int index : {Hashing1(key), Hashing2(key)})
+        {
+            Bucket &bucket = table[index];
+            for (int i = 0; i < SLOTS_PER_BUCKET; ++i)
+            {
+                if ((bucket.used >> i & 1) && bucket.keys[i] == key)
+                {
+                    bucket.used &= ~(1u << i);
+                    numOfElements--;
+                    return;
+                }
+            }
+        }
+
+        auto it = std::find(stash.begin(), stash.end(), key);
+        if (it != stash.end())
+        {
+            stash.erase(it);
+            numOfElements--;
+        }
+    }
+
+    // 탐색
+    /*
+     * 두 후보 버킷(각 4슬롯)과, 비어있지 않다면 stash만 확인합니다.
+     * 시간 복잡도: 최악 O(1)
+     */
+    bool find(int key) const
+    {
+        if (bucket_contains(table[Hashing1(key)], key) ||
+            bucket_contains(table[Hashing2(key)], key))
+        {
+            return true;
+        }
+
+        return !stash.empty() &&
+               std::find(stash.begin(), stash.end(), key) != stash.end();
+    }
+
+    // 리해싱
+    /*
+     * 기존의 모든 키와 아직 자리를 찾지 못한 키(pending)를 모아 버킷 수가
+     * 2배인 테이블에 다시 배치합니다. 배치에 실패하면 한 번 더 키웁니다.
+     * 시간 복잡도: O(n)
+     */
+    void rehashing(vector<int> pending = {})
+    {
+        for (const Bucket &bucket : table)
+        {
+            for (int i = 0; i < SLOTS_PER_BUCKET; ++i)
+            {
+                if (bucket.used >> i & 1)
+                {
+                    pending.push_back(bucket.keys[i]);
+                }
+            }
+        }
+        pending.insert(pending.end(), stash.begin(), stash.end());
+
+        bool placedAll;
+        do
+        {
+            bucketCount *= 2;
+            table.assign(bucketCount, Bucket{});
+            stash.clear();
+
+            placedAll = true;
+            for (int key : pending)
+            {
+                int homeless;
+                if (!place(key, homeless))
+                {
+                    placedAll = false;
+                    break;
+                }
+            }
+        } while (!placedAll);
+
+        numOfElements = static_cast<int>(pending.size());
+    }
+
+    // 부하율 계산
+    float get_load_factor() const
+    {
+        return (float)numOfElements / capacity();
+    }
+
+    // 출력
+    /*
+     * 버킷마다 사용 중인 슬롯을 출력하고, stash의 내용도 함께 출력합니다.
+     * 시간 복잡도: O(b) (b: 버킷의 수)
+     */
+    void display_hash() const
+    {
+        for (int b = 0; b < bucketCount; ++b)
+        {
+            cout << b;
+            for (int i = 0; i < SLOTS_PER_BUCKET; ++i)
+            {
+                if (table[b].used >> i & 1)
+                {
+                    cout << " -> " << table[b].keys[i];
+                }
+            }
+            cout << '\n';
+        }
+
+        cout << "stash:";
+        for (int key : stash)
+        {
+            cout << ' ' << key;
+        }
+        cout << '\n';
+    }
+
+private:
+    int capacity() const
+    {
+        return bucketCount * SLOTS_PER_BUCKET;
+    }
+
+    static bool bucket_contains(const Bucket &bucket, int key)
+    {
+        bool found = false;
+        for (int i = 0; i < SLOTS_PER_BUCKET; ++i)
+        {
+            found |= (bucket.used >> i & 1) && bucket.keys[i] == key;
+        }
+        return found;
+    }
+
+    // 버킷의 빈 슬롯에 키를 넣고, 성공하면 true를 반환합니다.
+    static bool try_put(Bucket &bucket, int key)
+    {
+        for (int i = 0; i < SLOTS_PER_BUCKET; ++i)
+        {
+            if (!(bucket.used >> i & 1))
+            {
+                bucket.keys[i] = key;
+                bucket.used |= 1u << i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t next_random()
+    {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 17;
+        randomState ^= randomState << 5;
+        return randomState;
+    }
+
+    // 키 배치
+    /*
+     * 두 후보 버킷에 빈 슬롯이 없다면 무작위 슬롯의 키를 쫓아내며 최대
+     * MAX_DISPLACEMENTS번 이동을 시도합니다. 실패하면 마지막으로 쫓겨난
+     * 키를 stash에 넣으며, stash도 가득 차면 그 키를 homeless로 돌려주고
+     * false를 반환합니다.
+     */
+    bool place(int key, int &homeless)
+    {
+        int index = Hashing1(key);
+        if (try_put(table[index], key) || try_put(table[Hashing2(key)], key))
+        {
+            return true;
+        }
+
+        for (int n = 0; n < MAX_DISPLACEMENTS; ++n)
+        {
+            Bucket &bucket = table[index];
+            int victim = next_random() % SLOTS_PER_BUCKET;
+            swap(key, bucket.keys[victim]);
+
+            // 쫓겨난 키를 다른 후보 버킷으로 옮깁니다.
+            int first = Hashing1(key);
+            index = (index == first) ? Hashing2(key) : first;
+
+            if (try_put(table[index], key))
+            {
+                return true;
+            }
+        }
+
+        if (stash.size() < STASH_SIZE)
+        {
+            stash.push_back(key);
+            return true;
+        }
+
+        homeless = key;
+        return false;
+    }
+
+    static int round_up_pow2(int n)
+    {
+        int pow2 = 1;
+        while (pow2 < n)
+        {
+            pow2 <<= 1;
+        }
+        return pow2;
+    }
+};
+
+// 비교용 체이닝 해시 테이블 (ChainingWithRehasing.cpp 와 같은 구조)
+class ChainingHash
+{
+    int bucketCount;
+    vector<vector<int>> table;
+    int numOfElements;
+
+    static constexpr float MAX_LOAD_FACTOR = 0.5f;
+
+public:
+    ChainingHash(int bucketCount) : bucketCount(bucketCount),
+                                    table(bucketCount),
+                                    numOfElements(0) {}
+
+    void insert_item(int key)
+    {
+        if ((float)numOfElements / bucketCount > MAX_LOAD_FACTOR)
+        {
+            bucketCount *= 2;
+            vector<vector<int>> oldTable(bucketCount);
+            oldTable.swap(table);
+            for (const auto &chain : oldTable)
+            {
+                for (int k : chain)
+                {
+                    table[Hashing(k)].push_back(k);
+                }
+            }
+        }
+
+        table[Hashing(key)].push_back(key);
+        numOfElements++;
+    }
+
+    bool find(int key) const
+    {
+        const auto &chain = table[Hashing(key)];
+        return std::find(chain.begin(), chain.end(), key) != chain.end();
+    }
+
+private:
+    int Hashing(int key) const
+    {
+        return static_cast<uint32_t>(key) % bucketCount;
+    }
+};
+
+// 키 하나당 평균 탐색 시간(나노초)을 측정합니다.
+template <typename Table>
+double measure_lookup_ns(const Table &table, const vector<int> &keys, long long &found)
+{
+    auto start = chrono::steady_clock::now();
+    for (int key : keys)
+    {
+        found += table.find(key);
+    }
+    chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count() / keys.size();
+}
+
+int main()
+{
+    vector<int> keys = {15, 11, 27, 8, 12};
+
+    Hash hash(2);
+    for (int key : keys)
+    {
+        hash.insert_item(key);
+    }
+
+    hash.delete_item(12);
+    hash.display_hash();
+
+    cout << "\n27 탐색: " << (hash.find(27) ? "있음" : "없음") << '\n';
+    cout << "12 탐색: " << (hash.find(12) ? "있음" : "없음") << '\n';
+
+    // 벤치마크
+    /*
+     * 홀수 곱셈은 2^32 위에서 전단사이므로 서로 다른 키가 만들어집니다.
+     * 앞쪽 N개는 삽입하고(성공 탐색), 뒤쪽 N개는 실패 탐색에 사용합니다.
+     */
+    const int N = 1000000;
+    vector<int> hitKeys;
+    vector<int> missKeys;
+    for (int i = 0; i < 2 * N; ++i)
+    {
+        int key = static_cast<int>(static_cast<uint32_t>(i) * 2654435761u);
+        (i < N ? hitKeys : missKeys).push_back(key);
+    }
+
+    Hash cuckoo(16);
+    ChainingHash chaining(7);
+    for (int key : hitKeys)
+    {
+        cuckoo.insert_item(key);
+        chaining.insert_item(key);
+    }
+
+    long long found = 0;
+    cout << "\n[탐색 지연 시간: 키 " << N << "개]\n";
+    cout << "Cuckoo   - 부하율: " << cuckoo.get_load_factor()
+         << ", hit: " << measure_lookup_ns(cuckoo, hitKeys, found) << "ns"
+         << ", miss: " << measure_lookup_ns(cuckoo, missKeys, found) << "ns\n";
+    cout << "Chaining - hit: " << measure_lookup_ns(chaining, hitKeys, found) << "ns"
+         << ", miss: " << measure_lookup_ns(chaining, missKeys, found) << "ns\n";
+    cout << "(찾은 키 " << found << "개)\n";
+
+    return 0;
+}
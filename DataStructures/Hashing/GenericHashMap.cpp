@@ -0,0 +1,411 @@
+/**
+ * 템플릿 기반 범용 해시 맵
+ *
+ * 키와 값의 타입, 해시 함수, 할당자를 템플릿 인자로 받는 체이닝 해시
+ * 맵입니다. Hash<Key, Value, Hasher, Alloc> 형태로 사용합니다.
+ *
+ * 기본 해시 함수(MixHash)는 곱셈과 시프트를 반복해 입력의 모든 비트가
+ * 결과의 모든 비트에 영향을 주도록 섞는 믹서(finalizer)입니다. 연속된 값이나
+ * 일정 간격(stride)을 가진 키도 버킷에 고르게 퍼지며, 음수 키도 항상
+ * 유효한 인덱스가 됩니다.
+ *
+ * 해시값이 충분히 섞여 있으므로 버킷 수를 2의 거듭제곱으로 유지하고,
+ * 나머지 연산 대신 비트 마스크로 인덱스를 계산합니다.
+ *
+ * 해시 함수에 is_transparent가 정의되어 있으면 string 키를 가진 맵에서
+ * string_view나 문자열 리터럴로 임시 string을 만들지 않고 탐색할 수
+ * 있습니다(heterogeneous lookup).
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <type_traits>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+
+using namespace std;
+
+// 64비트 믹서 (MurmurHash3 / xxHash 계열의 finalizer)
+inline uint64_t mix64(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+// 바이트열 해시
+/*
+ * 8바이트씩 읽어 누적값에 섞고, 마지막에 길이를 포함해 한 번 더 섞습니다.
+ */
+inline uint64_t hash_bytes(const char *data, size_t length)
+{
+    uint64_t h = 0x9E3779B97F4A7C15ull;
+    size_t i = 0;
+
+    for (; i + 8 <= length; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, data + i, 8);
+        h = mix64(h ^ word);
+    }
+
+    uint64_t tail = 0;
+    memcpy(&tail, data + i, length - i);
+    return mix64(h ^ tail ^ (length << 56));
+}
+
+// 해시 함수에 is_transparent가 정의되어 있는지 검사합니다.
+template <typename H, typename = void>
+struct is_transparent_hash : false_type
+{
+};
+
+template <typename H>
+struct is_transparent_hash<H, void_t<typename H::is_transparent>> : true_type
+{
+};
+
+// 기본 해시 함수
+template <typename Key, typename = void>
+struct MixHash;
+
+template <typename Key>
+struct MixHash<Key, enable_if_t<is_integral_v<Key> || is_enum_v<Key>>>
+{
+    size_t operator()(Key key) const
+    {
+        return static_cast<size_t>(mix64(static_cast<uint64_t>(key)));
+    }
+};
+
+template <>
+struct MixHash<string>
+{
+    // string_view, const char* 로 탐색할 수 있도록 허용합니다.
+    using is_transparent = void;
+
+    size_t operator()(string_view key) const
+    {
+        return static_cast<size_t>(hash_bytes(key.data(), key.size()));
+    }
+};
+
+template <typename Key,
+          typename Value,
+          typename Hasher = MixHash<Key>,
+          typename Alloc = allocator<pair<Key, Value>>>
+class Hash
+{
+    using Entry = pair<Key, Value>;
+    using Bucket = vector<Entry, Alloc>;
+    using BucketAlloc = typename allocator_traits<Alloc>::template rebind_alloc<Bucket>;
+
+    // 해시 함수가 투명(transparent)할 때만 다른 타입의 키로 탐색을 허용합니다.
+    template <typename K>
+    using enable_if_transparent = enable_if_t<
+        !is_same_v<decay_t<K>, Key> && is_transparent_hash<Hasher>::value>;
+
+    static constexpr float MAX_LOAD_FACTOR = 0.5f;
+
+    Hasher hasher;
+    Alloc alloc;
+
+    // 버킷 수는 항상 2의 거듭제곱입니다.
+    size_t bucketCount;
+    vector<Bucket, BucketAlloc> table;
+
+    size_t numOfElements;
+
+public:
+    explicit Hash(size_t bucketCount = 8,
+                  const Hasher &hasher = Hasher(),
+                  const Alloc &alloc = Alloc())
+        : hasher(hasher),
+          alloc(alloc),
+          bucketCount(round_up_pow2(bucketCount)),
+          table(this->bucketCount, Bucket(alloc), BucketAlloc(alloc)),
+          numOfElements(0) {}
+
+    // 해시 함수
+    /*
+     * 해시값의 하위 비트를 마스크로 잘라 버킷 인덱스를 구합니다.
+     */
+    template <typename K>
+    size_t Hashing(const K &key) const
+    {
+        return hasher(key) & (bucketCount - 1);
+    }
+
+    // 삽입
+    /*
+     * 키가 이미 있으면 값을 갱신하고, 없으면 새로 추가합니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    void insert_item(const Key &key, const Value &value)
+    {
+        if (Value *existing = find(key))
+        {
+            *existing = value;
+            return;
+        }
+
+        if ((float)(numOfElements + 1) / bucketCount > MAX_LOAD_FACTOR)
+        {
+            rehashing();
+        }
+
+        table[Hashing(key)].emplace_back(key, value);
+        numOfElements++;
+    }
+
+    // 삭제
+    /*
+     * 체인 안의 순서는 의미가 없으므로 마지막 요소와 바꾼 뒤 제거합니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    void delete_item(const Key &key)
+    {
+        Bucket &chain = table[Hashing(key)];
+        for (auto it = chain.begin(); it != chain.end(); ++it)
+        {
+            if (it->first == key)
+            {
+                swap(*it, chain.back());
+                chain.pop_back();
+                numOfElements--;
+                return;
+            }
+        }
+    }
+
+    // 탐색
+    /*
+     * 키에 해당하는 값의 포인터를 반환하며, 없으면 nullptr를 반환합니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    Value *find(const Key &key)
+    {
+        return find_in(table[Hashing(key)], key);
+    }
+
+    const Value *find(const Key &key) const
+    {
+        return find_in(table[Hashing(key)], key);
+    }
+
+    // 이종 키 탐색
+    /*
+     * 예: Hash<string, int> 에서 string_view 로 탐색
+     */
+    template <typename K, typename = enable_if_transparent<K>>
+    Value *find(const K &key)
+    {
+        return find_in(table[Hashing(key)], key);
+    }
+
+    template <typename K, typename = enable_if_transparent<K>>
+    const Value *find(const K &key) const
+    {
+        return find_in(table[Hashing(key)], key);
+    }
+
+    // 리해싱
+    /*
+     * 버킷 수를 2배로 늘리고 모든 요소를 새 버킷으로 옮깁니다.
+     * 시간 복잡도: O(n)
+     */
+    void rehashing()
+    {
+        bucketCount *= 2;
+        vector<Bucket, BucketAlloc> oldTable(bucketCount, Bucket(alloc), BucketAlloc(alloc));
+        oldTable.swap(table);
+
+        for (Bucket &chain : oldTable)
+        {
+            for (Entry &entry : chain)
+            {
+                table[Hashing(entry.first)].push_back(move(entry));
+            }
+        }
+    }
+
+    size_t size() const
+    {
+        return numOfElements;
+    }
+
+    // 부하율 계산
+    float get_load_factor() const
+    {
+        return (float)numOfElements / bucketCount;
+    }
+
+    // 가장 긴 체인의 길이
+    /*
+     * 해시 함수가 키를 얼마나 고르게 분산시키는지 확인할 때 사용합니다.
+     * 시간 복잡도: O(b)
+     */
+    size_t max_chain_length() const
+    {
+        size_t longest = 0;
+        for (const Bucket &chain : table)
+        {
+            longest = max(longest, chain.size());
+        }
+        return longest;
+    }
+
+    // 출력
+    /*
+     * 비어있지 않은 버킷만 출력합니다.
+     * 시간 복잡도: O(n + b) (b: 버킷의 수)
+     */
+    void display_hash() const
+    {
+        for (size_t i = 0; i < bucketCount; ++i)
+        {
+            if (table[i].empty())
+            {
+                continue;
+            }
+
+            cout << i;
+            for (const Entry &entry : table[i])
+            {
+                cout << " -> " << entry.first << ":" << entry.second;
+            }
+            cout << '\n';
+        }
+    }
+
+private:
+    template <typename K>
+    static Value *find_in(Bucket &chain, const K &key)
+    {
+        for (Entry &entry : chain)
+        {
+            if (entry.first == key)
+            {
+                return &entry.second;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename K>
+    static const Value *find_in(const Bucket &chain, const K &key)
+    {
+        for (const Entry &entry : chain)
+        {
+            if (entry.first == key)
+            {
+                return &entry.second;
+            }
+        }
+        return nullptr;
+    }
+
+    static size_t round_up_pow2(size_t n)
+    {
+        size_t pow2 = 1;
+        while (pow2 < n)
+        {
+            pow2 <<= 1;
+        }
+        return pow2;
+    }
+};
+
+// 비교용 해시 함수
+/*
+ * 기존 Hash 클래스의 key % bucketCount 와 같이 키를 그대로 사용합니다.
+ * 버킷 수가 2의 거듭제곱일 때는 키의 하위 비트만 인덱스에 반영됩니다.
+ */
+struct IdentityHash
+{
+    size_t operator()(int key) const
+    {
+        return static_cast<uint32_t>(key);
+    }
+};
+
+// 키 패턴별 최대 체인 길이와 삽입 + 탐색 시간을 출력합니다.
+template <typename Hasher>
+void benchmark(const char *name, const vector<int> &keys)
+{
+    auto start = chrono::steady_clock::now();
+
+    Hash<int, int, Hasher> hash;
+    for (int key : keys)
+    {
+        hash.insert_item(key, key);
+    }
+
+    long long found = 0;
+    for (int key : keys)
+    {
+        found += hash.find(key) != nullptr;
+    }
+
+    auto elapsed = chrono::steady_clock::now() - start;
+
+    cout << "  " << name << " - 최대 체인 길이: " << hash.max_chain_length()
+         << ", 시간: " << chrono::duration_cast<chrono::milliseconds>(elapsed).count()
+         << "ms (찾은 키 " << found << "개)\n";
+}
+
+int main()
+{
+    // 문자열 키와 이종 키 탐색
+    Hash<string, int> ages;
+    ages.insert_item("alice", 31);
+    ages.insert_item("bob", 27);
+    ages.insert_item("carol", 45);
+    ages.insert_item("bob", 28);
+    ages.delete_item("carol");
+    ages.display_hash();
+
+    string_view name = "bob";
+    if (const int *age = ages.find(name))
+    {
+        cout << name << " 의 나이: " << *age << '\n';
+    }
+    cout << "carol 탐색: " << (ages.find("carol") ? "있음" : "없음") << '\n';
+
+    // 음수 키도 안전하게 처리됩니다.
+    Hash<int, string> labels;
+    labels.insert_item(-15, "minus fifteen");
+    labels.insert_item(15, "fifteen");
+    cout << "\n-15 탐색: " << *labels.find(-15) << '\n';
+
+    // 규칙적인 키 패턴에서 해시 함수 비교
+    const int N = 30000;
+    vector<pair<const char *, vector<int>>> patterns(3);
+    patterns[0].first = "연속된 키 (i)";
+    patterns[1].first = "간격 1024 (i * 1024)";
+    patterns[2].first = "상위 비트만 사용 (i << 16)";
+    for (int i = 0; i < N; ++i)
+    {
+        patterns[0].second.push_back(i);
+        patterns[1].second.push_back(i * 1024);
+        patterns[2].second.push_back(i << 16);
+    }
+
+    cout << "\n[키 패턴별 해시 함수 비교: 키 " << N << "개]\n";
+    for (const auto &[patternName, keys] : patterns)
+    {
+        cout << patternName << '\n';
+        benchmark<IdentityHash>("IdentityHash", keys);
+        benchmark<MixHash<int>>("MixHash     ", keys);
+    }
+
+    return 0;
+}
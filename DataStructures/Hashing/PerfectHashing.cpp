@@ -0,0 +1,506 @@
+/**
+ * 정적 최소 완전 해시(Static Minimal Perfect Hash)
+ *
+ * 한 번 만들어진 뒤 변경되지 않는 키 집합에 대해, 충돌이 전혀 없고
+ * 테이블 크기가 키의 수와 정확히 같은(최소) 해시 함수를 미리 계산합니다.
+ * 탐색 시에는 체이닝, 탐사, 부하율 검사가 필요 없습니다.
+ *
+ * 해시 후 변위(Hash and Displace, CHD/PTHash 계열) 방식을 사용합니다.
+ *  1. 키들을 첫 번째 해시로 작은 버킷들(평균 4개)에 나눕니다.
+ *  2. 큰 버킷부터 차례로, 버킷의 모든 키가 아직 비어있는 서로 다른
+ *     위치에 놓이도록 하는 정수(pilot)를 찾습니다.
+ *  3. 탐색 시 위치 = 해시(키, pilot[버킷]) 이며, 해당 슬롯에 저장된 키와
+ *     비교해 집합에 없는 키를 걸러냅니다.
+ *
+ * 위치를 키의 수와 같은 크기의 테이블에 바로 놓으면, 마지막 버킷들은 남은 몇
+ * 개의 빈 자리를 찾기 위해 키의 수에 비례하는 pilot을 시도해야 합니다.
+ * 그래서 PTHash 처럼 위치는 조금 더 큰 테이블(n / ALPHA)에서 찾고, n 이상인
+ * 위치는 n 미만의 빈 슬롯으로 다시 매핑(remap)해 슬롯 배열은 최소 크기로
+ * 유지합니다.
+ *
+ * 만들어진 결과는 헤더, pilot 배열, 슬롯 배열이 연속된 이진 형식으로
+ * 저장되며, 파일을 메모리에 매핑(mmap)해 별도의 파싱 없이 바로 탐색할 수
+ * 있습니다. 작은 pilot 배열은 대부분 캐시에 머무르므로 탐색은 슬롯 배열에
+ * 대한 한 번의 메모리 접근과 키 비교로 끝납니다.
+ *
+ */
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+
+#if defined(_WIN32)
+#define PERFECT_HASH_NO_MMAP 1
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// 이진 형식
+/*
+ * [Header][uint32_t pilots[bucketCount]][uint32_t remap[tableSize - numOfKeys]]
+ * [Slot slots[numOfKeys]]
+ * 모든 값은 빌드한 기계의 바이트 순서(native endian)로 저장됩니다.
+ */
+struct PerfectHashHeader
+{
+    uint32_t magic;
+    uint32_t numOfKeys;
+    uint32_t bucketCount;
+    uint32_t tableSize; // pilot으로 위치를 찾는 테이블의 크기 (numOfKeys 이상)
+    uint32_t seed;
+};
+
+struct PerfectHashSlot
+{
+    int key;
+    int value;
+};
+
+static constexpr uint32_t PERFECT_HASH_MAGIC = 0x32464850; // "PHF2"
+
+inline uint64_t mix64(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+// 키의 해시 (상위 32비트: 버킷 선택, 전체: 위치 계산)
+inline uint64_t key_hash(int key, uint32_t seed)
+{
+    return mix64(static_cast<uint32_t>(key) ^ (static_cast<uint64_t>(seed) << 32));
+}
+
+inline uint32_t bucket_of(uint64_t h, uint32_t bucketCount)
+{
+    return static_cast<uint32_t>((h >> 32) % bucketCount);
+}
+
+// h ^ 상수를 나머지 연산하면 테이블 크기가 2의 거듭제곱일 때 하위 비트가 같은
+// 키들은 어떤 pilot으로도 갈라지지 않으므로, pilot을 더한 뒤 다시 섞습니다.
+inline uint32_t position_of(uint64_t h, uint32_t pilot, uint32_t tableSize)
+{
+    return static_cast<uint32_t>(mix64(h + pilot) % tableSize);
+}
+
+// 빌더
+/*
+ * (키, 값) 목록으로 완전 해시의 이진 이미지를 만듭니다.
+ * 중복된 키가 있으면 invalid_argument 예외를, MAX_SEEDS 개의 seed로 모두
+ * 실패하면 runtime_error 예외를 던집니다.
+ * 시간 복잡도: 평균 O(n log n)
+ */
+class PerfectHashBuilder
+{
+    static constexpr int KEYS_PER_BUCKET = 4;
+    static constexpr double ALPHA = 0.99; // 테이블 중 키가 차지하는 비율
+    static constexpr uint32_t MAX_PILOT = 1u << 20;
+    static constexpr uint32_t MAX_SEEDS = 32;
+
+public:
+    static vector<char> build(const vector<PerfectHashSlot> &entries)
+    {
+        unordered_set<int> unique;
+        for (const PerfectHashSlot &entry : entries)
+        {
+            if (!unique.insert(entry.key).second)
+            {
+                throw invalid_argument("Duplicate key");
+            }
+        }
+
+        // pilot을 찾지 못하는 버킷이 생기면 다른 seed로 처음부터 다시 시도합니다.
+        for (uint32_t seed = 1; seed <= MAX_SEEDS; ++seed)
+        {
+            vector<char> image;
+            if (try_build(entries, seed, image))
+            {
+                return image;
+            }
+        }
+        throw runtime_error("Perfect hash build failed");
+    }
+
+private:
+    static bool try_build(const vector<PerfectHashSlot> &entries, uint32_t seed, vector<char> &image)
+    {
+        uint32_t n = static_cast<uint32_t>(entries.size());
+        uint32_t bucketCount = max(1u, n / KEYS_PER_BUCKET);
+        uint32_t tableSize = max(n, static_cast<uint32_t>(ceil(n / ALPHA)));
+
+        // 1. 키를 버킷별로 나눕니다.
+        vector<uint64_t> hashes(n);
+        vector<vector<uint32_t>> buckets(bucketCount);
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            hashes[i] = key_hash(entries[i].key, seed);
+            buckets[bucket_of(hashes[i], bucketCount)].push_back(i);
+        }
+
+        // 2. 키가 많은 버킷부터 처리합니다. (자리가 많이 남아있을 때 어려운 버킷을 배치)
+        vector<uint32_t> order(bucketCount);
+        for (uint32_t b = 0; b < bucketCount; ++b)
+        {
+            order[b] = b;
+        }
+        stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b)
+                    { return buckets[a].size() > buckets[b].size(); });
+
+        vector<uint32_t> pilots(bucketCount, 0);
+        vector<char> taken(tableSize, 0);
+        vector<uint32_t> positions;
+
+        for (uint32_t b : order)
+        {
+            const vector<uint32_t> &bucket = buckets[b];
+            if (bucket.empty())
+            {
+                break;
+            }
+
+            uint32_t pilot = 0;
+            for (; pilot < MAX_PILOT; ++pilot)
+            {
+                if (fits(hashes, bucket, pilot, tableSize, taken, positions))
+                {
+                    break;
+                }
+            }
+
+            if (pilot == MAX_PILOT)
+            {
+                return false;
+            }
+
+            pilots[b] = pilot;
+            for (uint32_t pos : positions)
+            {
+                taken[pos] = 1;
+            }
+        }
+
+        // 3. n 이상인 위치를 n 미만의 빈 슬롯에 차례로 연결합니다.
+        // (n 이상에 놓인 키의 수와 n 미만의 빈 슬롯 수는 같습니다)
+        vector<uint32_t> remap(tableSize - n, 0);
+        uint32_t freeSlot = 0;
+        for (uint32_t pos = n; pos < tableSize; ++pos)
+        {
+            if (taken[pos])
+            {
+                while (taken[freeSlot])
+                {
+                    ++freeSlot;
+                }
+                remap[pos - n] = freeSlot++;
+            }
+        }
+
+        // 4. 이진 이미지를 만듭니다.
+        vector<PerfectHashSlot> slots(n);
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            uint32_t pos = position_of(hashes[i], pilots[bucket_of(hashes[i], bucketCount)], tableSize);
+            slots[pos < n ? pos : remap[pos - n]] = entries[i];
+        }
+
+        PerfectHashHeader header = {PERFECT_HASH_MAGIC, n, bucketCount, tableSize, seed};
+        image.resize(sizeof(header) + pilots.size() * sizeof(uint32_t) + remap.size() * sizeof(uint32_t) +
+                     slots.size() * sizeof(PerfectHashSlot));
+
+        char *out = image.data();
+        memcpy(out, &header, sizeof(header));
+        out += sizeof(header);
+        memcpy(out, pilots.data(), pilots.size() * sizeof(uint32_t));
+        out += pilots.size() * sizeof(uint32_t);
+        memcpy(out, remap.data(), remap.size() * sizeof(uint32_t));
+        out += remap.size() * sizeof(uint32_t);
+        memcpy(out, slots.data(), slots.size() * sizeof(PerfectHashSlot));
+
+        return true;
+    }
+
+    // 버킷의 모든 키가 비어있는 서로 다른 위치에 놓이는지 검사합니다.
+    static bool fits(const vector<uint64_t> &hashes, const vector<uint32_t> &bucket,
+                     uint32_t pilot, uint32_t tableSize,
+                     const vector<char> &taken, vector<uint32_t> &positions)
+    {
+        positions.clear();
+        for (uint32_t i : bucket)
+        {
+            uint32_t pos = position_of(hashes[i], pilot, tableSize);
+            if (taken[pos] || find(positions.begin(), positions.end(), pos) != positions.end())
+            {
+                return false;
+            }
+            positions.push_back(pos);
+        }
+        return true;
+    }
+};
+
+// 읽기 전용 완전 해시
+/*
+ * 빌더가 만든 이미지(메모리 또는 매핑된 파일)를 그대로 가리키며 탐색합니다.
+ * 복사할 수 없고 이동만 가능합니다.
+ */
+class PerfectHash
+{
+    vector<char> buffer; // 메모리에 있는 이미지 (매핑한 경우 비어있음)
+    void *mapped;        // 매핑된 파일의 시작 주소
+    size_t mappedSize;
+
+    PerfectHashHeader header;
+    const uint32_t *pilots;
+    const uint32_t *remap;
+    const PerfectHashSlot *slots;
+
+public:
+    // 빌더가 만든 이미지로부터 생성합니다.
+    explicit PerfectHash(vector<char> image) : buffer(move(image)), mapped(nullptr), mappedSize(0)
+    {
+        attach(buffer.data(), buffer.size());
+    }
+
+    PerfectHash(PerfectHash &&other) noexcept
+        : buffer(move(other.buffer)),
+          mapped(other.mapped),
+          mappedSize(other.mappedSize),
+          header(other.header),
+          pilots(other.pilots),
+          remap(other.remap),
+          slots(other.slots)
+    {
+        other.mapped = nullptr;
+        other.mappedSize = 0;
+    }
+
+    PerfectHash(const PerfectHash &) = delete;
+    PerfectHash &operator=(const PerfectHash &) = delete;
+    PerfectHash &operator=(PerfectHash &&) = delete;
+
+    ~PerfectHash()
+    {
+#ifndef PERFECT_HASH_NO_MMAP
+        if (mapped != nullptr)
+        {
+            munmap(mapped, mappedSize);
+        }
+#endif
+    }
+
+    // 파일 불러오기
+    /*
+     * POSIX 환경에서는 파일을 읽기 전용으로 메모리에 매핑하므로, 필요한
+     * 페이지만 운영체제가 읽어오며 여러 프로세스가 같은 페이지를 공유합니다.
+     * 매핑을 지원하지 않는 환경에서는 파일 전체를 읽어옵니다.
+     */
+    static PerfectHash load(const string &path)
+    {
+#ifdef PERFECT_HASH_NO_MMAP
+        ifstream in(path, ios::binary);
+        if (!in)
+        {
+            throw runtime_error("Cannot open " + path);
+        }
+        return PerfectHash(vector<char>(istreambuf_iterator<char>(in), istreambuf_iterator<char>()));
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw runtime_error("Cannot open " + path);
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) == -1 || info.st_size < (off_t)sizeof(PerfectHashHeader))
+        {
+            close(fd);
+            throw runtime_error("Invalid perfect hash file");
+        }
+
+        size_t size = static_cast<size_t>(info.st_size);
+        void *address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (address == MAP_FAILED)
+        {
+            throw runtime_error("mmap failed");
+        }
+
+        PerfectHash hash;
+        hash.mapped = address;
+        hash.mappedSize = size;
+        hash.attach(static_cast<const char *>(address), size);
+        return hash;
+#endif
+    }
+
+    // 파일로 저장합니다.
+    void save(const string &path) const
+    {
+        ofstream out(path, ios::binary);
+        if (!out)
+        {
+            throw runtime_error("Cannot open " + path);
+        }
+
+        const char *data = mapped != nullptr ? static_cast<const char *>(mapped) : buffer.data();
+        out.write(data, mapped != nullptr ? mappedSize : buffer.size());
+    }
+
+    // 탐색
+    /*
+     * 키가 집합에 있으면 값을 value에 저장하고 true를 반환합니다.
+     * pilot 조회 후 슬롯 하나만 읽어 키를 비교합니다. (위치가 n 이상인
+     * 약 1%의 키는 remap 을 한 번 더 읽습니다)
+     * 시간 복잡도: 최악 O(1)
+     */
+    bool find(int key, int &value) const
+    {
+        if (header.numOfKeys == 0)
+        {
+            return false;
+        }
+
+        uint64_t h = key_hash(key, header.seed);
+        uint32_t pilot = pilots[bucket_of(h, header.bucketCount)];
+        uint32_t pos = position_of(h, pilot, header.tableSize);
+        if (pos >= header.numOfKeys)
+        {
+            pos = remap[pos - header.numOfKeys];
+        }
+        const PerfectHashSlot &slot = slots[pos];
+
+        if (slot.key != key)
+        {
+            return false;
+        }
+
+        value = slot.value;
+        return true;
+    }
+
+    size_t size() const
+    {
+        return header.numOfKeys;
+    }
+
+    // 키 하나당 사용하는 바이트 수 (헤더 제외)
+    double bytes_per_key() const
+    {
+        if (header.numOfKeys == 0)
+        {
+            return 0.0;
+        }
+        return (double)((header.bucketCount + header.tableSize - header.numOfKeys) * sizeof(uint32_t) +
+                        header.numOfKeys * sizeof(PerfectHashSlot)) / header.numOfKeys;
+    }
+
+private:
+    PerfectHash() : mapped(nullptr), mappedSize(0), header(), pilots(nullptr), remap(nullptr), slots(nullptr) {}
+
+    // 이미지의 헤더를 검사하고 각 배열의 시작 위치를 설정합니다.
+    void attach(const char *data, size_t size)
+    {
+        if (size < sizeof(PerfectHashHeader))
+        {
+            throw runtime_error("Invalid perfect hash image");
+        }
+
+        memcpy(&header, data, sizeof(header));
+        if (header.magic != PERFECT_HASH_MAGIC || header.tableSize < header.numOfKeys)
+        {
+            throw runtime_error("Invalid perfect hash image");
+        }
+
+        size_t remapCount = header.tableSize - header.numOfKeys;
+        size_t expected = sizeof(header) +
+                          ((size_t)header.bucketCount + remapCount) * sizeof(uint32_t) +
+                          (size_t)header.numOfKeys * sizeof(PerfectHashSlot);
+
+        if (size != expected)
+        {
+            throw runtime_error("Invalid perfect hash image");
+        }
+
+        pilots = reinterpret_cast<const uint32_t *>(data + sizeof(header));
+        remap = pilots + header.bucketCount;
+        slots = reinterpret_cast<const PerfectHashSlot *>(remap + remapCount);
+    }
+};
+
+int main()
+{
+    vector<PerfectHashSlot> entries = {{15, 150}, {11, 110}, {27, 270}, {8, 80}, {12, 120}};
+
+    PerfectHash hash(PerfectHashBuilder::build(entries));
+
+    int value;
+    for (int key : {15, 11, 27, 8, 12, 33})
+    {
+        if (hash.find(key, value))
+        {
+            cout << key << " -> " << value << '\n';
+        }
+        else
+        {
+            cout << key << " -> 없음\n";
+        }
+    }
+
+    // 큰 키 집합으로 빌드, 저장, 매핑 후 탐색
+    const int N = 1000000;
+    mt19937 rng(42);
+    unordered_set<int> uniqueKeys;
+    vector<PerfectHashSlot> bigEntries;
+    while ((int)bigEntries.size() < N)
+    {
+        int key = static_cast<int>(rng());
+        if (uniqueKeys.insert(key).second)
+        {
+            bigEntries.push_back({key, (int)bigEntries.size()});
+        }
+    }
+
+    auto start = chrono::steady_clock::now();
+    PerfectHash built(PerfectHashBuilder::build(bigEntries));
+    chrono::duration<double, milli> buildTime = chrono::steady_clock::now() - start;
+
+    const string path = "perfect_hash.bin";
+    built.save(path);
+    PerfectHash loaded = PerfectHash::load(path);
+
+    start = chrono::steady_clock::now();
+    long long found = 0;
+    for (const PerfectHashSlot &entry : bigEntries)
+    {
+        found += loaded.find(entry.key, value) && value == entry.value;
+    }
+    chrono::duration<double, nano> lookupTime = chrono::steady_clock::now() - start;
+
+    cout << "\n[키 " << N << "개]\n";
+    cout << "빌드 시간: " << buildTime.count() << "ms\n";
+    cout << "키당 바이트: " << loaded.bytes_per_key() << '\n';
+    cout << "탐색: " << lookupTime.count() / N << "ns/키 (찾은 키 " << found << "개)\n";
+
+    remove(path.c_str());
+
+    return 0;
+}
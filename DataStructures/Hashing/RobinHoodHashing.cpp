@@ -0,0 +1,450 @@
+/**
+ * 로빈 후드 해싱(Robin Hood Hashing)을 사용한 해시 테이블
+ *
+ * 오픈 어드레싱(선형 탐사) 방식으로 모든 키를 하나의 연속된 배열에
+ * 저장합니다. 체이닝처럼 버킷마다 별도의 벡터를 할당하지 않으므로 조회 시
+ * 포인터를 따라갈 필요가 없고, 대부분의 조회가 한두 개의 캐시 라인 안에서
+ * 끝납니다.
+ *
+ * 삽입 중 자신의 탐사 거리(원래 위치로부터 떨어진 거리)가 현재 슬롯에 있는
+ * 키보다 길다면 자리를 빼앗고, 밀려난 키가 계속 탐사를 이어갑니다.
+ * ("가난한" 키가 "부유한" 키의 자리를 가져간다는 의미에서 로빈 후드)
+ * 이 덕분에 탐사 거리의 편차가 작아져 높은 부하율에서도 성능이 유지됩니다.
+ *
+ * 삭제는 묘비(tombstone) 대신 뒤쪽 요소들을 한 칸씩 당기는
+ * 후방 이동(backward shift) 방식을 사용합니다.
+ *
+ * 여러 키를 한 번에 조회하는 일괄 탐색(find_batch)은 키들의 해시를 먼저
+ * 계산해 대상 슬롯을 미리 가져오도록(prefetch) 요청한 뒤 실제 비교를
+ * 수행합니다. 서로 독립적인 키들의 메모리 접근이 겹쳐서 진행되므로,
+ * 캐시보다 훨씬 큰 테이블에서 메모리 지연 시간을 숨길 수 있습니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <random>
+#include <chrono>
+#include <memory>
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+using namespace std;
+
+class Hash
+{
+    // 각 슬롯은 키와 원래 위치로부터의 탐사 거리를 저장합니다.
+    // 8바이트 슬롯 8개가 하나의 캐시 라인(64바이트)에 들어갑니다.
+    struct Slot
+    {
+        int key;
+        int dist; // EMPTY(-1)이면 비어있는 슬롯
+    };
+
+    static constexpr int EMPTY = -1;
+
+    // 일괄 연산에서 한 번에 프리페치하는 키의 수
+    static constexpr int BATCH_SIZE = 32;
+
+    // 체이닝보다 훨씬 높은 부하율까지 사용할 수 있습니다.
+    static constexpr float MAX_LOAD_FACTOR = 0.9f;
+
+    // 버킷 수는 항상 2의 거듭제곱으로 유지해 나머지 연산 대신
+    // 시프트와 비트 마스크로 인덱스를 계산합니다.
+    int bucketCount;
+    int mask;
+    int shift;
+    vector<Slot> table;
+
+    int numOfElements;
+
+public:
+    Hash(int bucketCount) : bucketCount(round_up_pow2(bucketCount)),
+                            mask(this->bucketCount - 1),
+                            shift(64 - log2(this->bucketCount)),
+                            table(this->bucketCount, {0, EMPTY}),
+                            numOfElements(0) {}
+
+    // 해시 함수
+    /*
+     * 피보나치 곱셈 해싱으로 키를 섞은 뒤 상위 비트를 인덱스로 사용합니다.
+     * (곱셈 결과는 상위 비트일수록 잘 섞여 있습니다.)
+     * 음수 키도 부호 없는 정수로 변환되어 항상 유효한 인덱스가 됩니다.
+     */
+    int Hashing(int key) const
+    {
+        uint64_t h = static_cast<uint32_t>(key) * 11400714819323198485ull;
+        return static_cast<int>(h >> shift);
+    }
+
+    // 삽입
+    /*
+     * 빈 슬롯을 찾을 때까지 탐사하며, 현재 슬롯의 키보다 탐사 거리가
+     * 길어지면 두 키를 교환하고 밀려난 키로 탐사를 계속합니다.
+     * 이미 존재하는 키는 다시 삽입하지 않습니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    void insert_item(int key)
+    {
+        if (find(key))
+        {
+            return;
+        }
+
+        if (numOfElements + 1 > MAX_LOAD_FACTOR * bucketCount)
+        {
+            rehashing();
+        }
+
+        Slot cur = {key, 0};
+        int index = Hashing(key);
+
+        while (true)
+        {
+            Slot &slot = table[index];
+
+            if (slot.dist == EMPTY)
+            {
+                slot = cur;
+                numOfElements++;
+                return;
+            }
+
+            // 기존 키가 더 "부유"하다면(원래 위치에 더 가깝다면) 자리를 빼앗습니다.
+            if (slot.dist < cur.dist)
+            {
+                swap(slot, cur);
+            }
+
+            cur.dist++;
+            index = (index + 1) & mask;
+        }
+    }
+
+    // 삭제
+    /*
+     * 키를 찾은 뒤, 뒤따르는 슬롯들 중 원래 위치가 아닌 곳에 있는 키들을
+     * 한 칸씩 앞으로 당깁니다(backward shift). 묘비를 남기지 않으므로
+     * 삭제가 반복되어도 탐사 거리가 늘어나지 않습니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    void delete_item(int key)
+    {
+        int index = find_index(key);
+        if (index == -1)
+        {
+            return;
+        }
+
+        int next = (index + 1) & mask;
+        while (table[next].dist > 0)
+        {
+            table[index] = table[next];
+            table[index].dist--;
+            index = next;
+            next = (next + 1) & mask;
+        }
+
+        table[index].dist = EMPTY;
+        numOfElements--;
+    }
+
+    // 탐색
+    /*
+     * 키가 존재하면 true를 반환합니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    bool find(int key) const
+    {
+        return find_index(key) != -1;
+    }
+
+    // 리해싱
+    /*
+     * 테이블의 크기를 2배로 늘리고 모든 키를 다시 삽입합니다.
+     * 시간 복잡도: O(n)
+     */
+    void rehashing()
+    {
+        vector<Slot> oldTable;
+        oldTable.swap(table);
+
+        bucketCount *= 2;
+        mask = bucketCount - 1;
+        shift--;
+        table.assign(bucketCount, {0, EMPTY});
+        numOfElements = 0;
+
+        for (const Slot &slot : oldTable)
+        {
+            if (slot.dist != EMPTY)
+            {
+                insert_item(slot.key);
+            }
+        }
+    }
+
+    // 일괄 탐색
+    /*
+     * keys[0..count) 의 존재 여부를 results[0..count) 에 기록합니다.
+     * BATCH_SIZE개씩 묶어 먼저 해시를 계산하고 대상 슬롯을 프리페치한 뒤,
+     * 같은 묶음을 다시 순회하며 탐색을 마칩니다. 묶음이 너무 크면 먼저
+     * 가져온 캐시 라인이 사용되기 전에 밀려날 수 있으므로 크기를 제한합니다.
+     * 시간 복잡도: 평균 O(count)
+     */
+    void find_batch(const int *keys, int count, bool *results) const
+    {
+        int indices[BATCH_SIZE];
+
+        for (int begin = 0; begin < count; begin += BATCH_SIZE)
+        {
+            int end = min(begin + BATCH_SIZE, count);
+
+            for (int i = begin; i < end; ++i)
+            {
+                indices[i - begin] = Hashing(keys[i]);
+                prefetch(&table[indices[i - begin]]);
+            }
+
+            for (int i = begin; i < end; ++i)
+            {
+                results[i] = find_index(keys[i], indices[i - begin]) != -1;
+            }
+        }
+    }
+
+    // 일괄 삽입
+    /*
+     * 일괄 탐색과 같은 방식으로 대상 슬롯을 미리 가져온 뒤 삽입합니다.
+     * 삽입 도중 리해싱이 일어날 수 있으므로 인덱스는 다시 계산합니다.
+     * 시간 복잡도: 평균 O(count)
+     */
+    void insert_batch(const int *keys, int count)
+    {
+        for (int begin = 0; begin < count; begin += BATCH_SIZE)
+        {
+            int end = min(begin + BATCH_SIZE, count);
+
+            for (int i = begin; i < end; ++i)
+            {
+                prefetch(&table[Hashing(keys[i])]);
+            }
+
+            for (int i = begin; i < end; ++i)
+            {
+                insert_item(keys[i]);
+            }
+        }
+    }
+
+    // 부하율 계산
+    float get_load_factor() const
+    {
+        return (float)numOfElements / bucketCount;
+    }
+
+    // 최대 탐사 길이
+    /*
+     * 가장 멀리 밀려난 키가 원래 위치에서 몇 칸 떨어져 있는지 반환합니다.
+     * 시간 복잡도: O(b)
+     */
+    int get_max_probe_length() const
+    {
+        int maxDist = 0;
+        for (const Slot &slot : table)
+        {
+            if (slot.dist > maxDist)
+            {
+                maxDist = slot.dist;
+            }
+        }
+        return maxDist;
+    }
+
+    // 평균 탐사 길이
+    /*
+     * 저장된 키들의 평균 탐사 거리를 반환합니다.
+     * 시간 복잡도: O(b)
+     */
+    float get_average_probe_length() const
+    {
+        if (numOfElements == 0)
+        {
+            return 0.0f;
+        }
+
+        long long total = 0;
+        for (const Slot &slot : table)
+        {
+            if (slot.dist != EMPTY)
+            {
+                total += slot.dist;
+            }
+        }
+        return (float)total / numOfElements;
+    }
+
+    // 출력
+    /*
+     * 모든 슬롯을 순회하며 저장된 값과 탐사 거리를 출력합니다.
+     * 시간 복잡도: O(b) (b: 버킷의 수)
+     */
+    void display_hash() const
+    {
+        for (int i = 0; i < bucketCount; ++i)
+        {
+            cout << i;
+            if (table[i].dist != EMPTY)
+            {
+                cout << " -> " << table[i].key << " (거리 " << table[i].dist << ")";
+            }
+            cout << '\n';
+        }
+    }
+
+private:
+    // 키가 저장된 슬롯의 인덱스를 반환하며, 없으면 -1을 반환합니다.
+    /*
+     * 탐사 중 현재 탐사 거리보다 짧은 거리의 키를 만나면, 찾는 키가
+     * 있었다면 이미 그 자리를 차지했을 것이므로 즉시 탐색을 종료합니다.
+     */
+    int find_index(int key) const
+    {
+        return find_index(key, Hashing(key));
+    }
+
+    int find_index(int key, int index) const
+    {
+        int dist = 0;
+
+        while (table[index].dist != EMPTY && table[index].dist >= dist)
+        {
+            if (table[index].key == key)
+            {
+                return index;
+            }
+
+            dist++;
+            index = (index + 1) & mask;
+        }
+
+        return -1;
+    }
+
+    static void prefetch(const void *address)
+    {
+#if defined(_MSC_VER)
+        _mm_prefetch(static_cast<const char *>(address), _MM_HINT_T0);
+#else
+        __builtin_prefetch(address);
+#endif
+    }
+
+    static int round_up_pow2(int n)
+    {
+        int pow2 = 2;
+        while (pow2 < n)
+        {
+            pow2 <<= 1;
+        }
+        return pow2;
+    }
+
+    static int log2(int pow2)
+    {
+        int bits = 0;
+        while ((1 << bits) < pow2)
+        {
+            bits++;
+        }
+        return bits;
+    }
+};
+
+int main()
+{
+    vector<int> keys = {15, 11, 27, 8, 12};
+
+    Hash hash(8);
+    for (int key : keys)
+    {
+        hash.insert_item(key);
+    }
+
+    hash.delete_item(12);
+    hash.display_hash();
+
+    cout << "\n27 탐색: " << (hash.find(27) ? "있음" : "없음") << '\n';
+    cout << "12 탐색: " << (hash.find(12) ? "있음" : "없음") << '\n';
+
+    // 높은 부하율에서의 탐사 길이 확인 (무작위 키 58000개)
+    mt19937 rng(42);
+    vector<int> randomKeys(58000);
+    for (int &key : randomKeys)
+    {
+        key = static_cast<int>(rng());
+    }
+
+    Hash large(1 << 16);
+    for (int key : randomKeys)
+    {
+        large.insert_item(key);
+    }
+
+    cout << "\n부하율: " << large.get_load_factor() << '\n';
+    cout << "최대 탐사 길이: " << large.get_max_probe_length() << '\n';
+    cout << "평균 탐사 길이: " << large.get_average_probe_length() << '\n';
+
+    for (size_t i = 0; i < randomKeys.size(); i += 2)
+    {
+        large.delete_item(randomKeys[i]);
+    }
+
+    cout << "\n절반 삭제 후 부하율: " << large.get_load_factor() << '\n';
+    cout << "최대 탐사 길이: " << large.get_max_probe_length() << '\n';
+    cout << "평균 탐사 길이: " << large.get_average_probe_length() << '\n';
+
+    // 단일 탐색 반복과 일괄 탐색 비교
+    /*
+     * 슬롯 2^24개(약 128MB)로 캐시보다 훨씬 큰 테이블을 만들고,
+     * 절반은 존재하는 키, 절반은 존재하지 않는 키로 탐색합니다.
+     */
+    const int N = 8000000;
+    vector<int> benchKeys(N);
+    for (int &key : benchKeys)
+    {
+        key = static_cast<int>(rng());
+    }
+
+    Hash huge(2 * N);
+    huge.insert_batch(benchKeys.data(), N / 2);
+
+    vector<char> singleResults(N);
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < N; ++i)
+    {
+        singleResults[i] = huge.find(benchKeys[i]);
+    }
+    chrono::duration<double, nano> singleTime = chrono::steady_clock::now() - start;
+
+    unique_ptr<bool[]> batchResults(new bool[N]);
+    start = chrono::steady_clock::now();
+    huge.find_batch(benchKeys.data(), N, batchResults.get());
+    chrono::duration<double, nano> batchTime = chrono::steady_clock::now() - start;
+
+    int mismatches = 0;
+    for (int i = 0; i < N; ++i)
+    {
+        mismatches += singleResults[i] != batchResults[i];
+    }
+
+    cout << "\n[탐색 " << N << "회, 테이블 약 128MB]\n";
+    cout << "단일 탐색 반복: " << singleTime.count() / N << "ns/키\n";
+    cout << "일괄 탐색: " << batchTime.count() / N << "ns/키\n";
+    cout << "결과 불일치: " << mismatches << "개\n";
+
+    return 0;
+}
@@ -8,14 +8,41 @@
  *
  * 모든 요소가 한 체인에 몰리는 최악의 경우 성능 저하가 발생합니다.
  *
+ * get_stats()는 체인 길이 분포와 요소당 메모리 사용량 등을 반환합니다.
+ * HASH_COUNT_PROBES 를 정의하고 컴파일하면 탐색당 비교 횟수도 함께
+ * 집계합니다. (예: g++ -DHASH_COUNT_PROBES)
+ *
  */
 
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <random>
 
 using namespace std;
 
+// 해시 테이블 통계
+struct HashStats
+{
+    int bucketCount;
+    int numOfElements;
+    float loadFactor;
+
+    // chainLengthHistogram[k] = 길이가 k인 체인(버킷)의 수
+    vector<int> chainLengthHistogram;
+    int maxChainLength;
+
+    // 테이블 구조, 버킷 벡터, 키 저장 공간을 모두 포함한 요소당 바이트 수
+    double bytesPerElement;
+
+    // loadSampleInterval번의 삽입/삭제마다 기록한 부하율
+    vector<float> loadFactorHistory;
+    int loadSampleInterval;
+
+    // 탐색(삭제 포함) 한 번당 평균 키 비교 횟수 (HASH_COUNT_PROBES 미정의 시 -1)
+    double averageProbesPerLookup;
+};
+
 class Hash
 {
     // 해시테이블은 bucketCount개의 버킷을 가지고 있으며,
@@ -23,9 +50,31 @@ class Hash
     int bucketCount;
     vector<vector<int>> table;
 
+    int numOfElements;
+
+    // 통계
+    /*
+     * 부하율 기록이 MAX_LOAD_SAMPLES개에 도달하면 기록을 하나 건너
+     * 하나씩 버리고 기록 간격을 2배로 늘려 메모리 사용량을 일정하게
+     * 유지합니다.
+     */
+    vector<float> loadFactorHistory;
+    int loadSampleInterval;
+    int opsSinceSample;
+
+    static constexpr int MAX_LOAD_SAMPLES = 256;
+
+#ifdef HASH_COUNT_PROBES
+    mutable long long lookupCount = 0;
+    mutable long long probeCount = 0;
+#endif
+
 public:
     Hash(int bucketCount) : bucketCount(bucketCount),
-                            table(bucketCount) {}
+                            table(bucketCount),
+                            numOfElements(0),
+                            loadSampleInterval(1),
+                            opsSinceSample(0) {}
 
     // 해시 함수
     /*
@@ -45,6 +94,8 @@ public:
     {
         int index = Hashing(key);
         table[index].push_back(key);
+        numOfElements++;
+        record_load_sample();
     }
 
     // 삭제
@@ -56,10 +107,110 @@ public:
     {
         int index = Hashing(key);
         auto &chain = table[index];
-        auto it = find(chain.begin(), chain.end(), key);
+        auto it = std::find(chain.begin(), chain.end(), key);
+        count_probes(chain, it);
         if (it != chain.end())
         {
             chain.erase(it);
+            numOfElements--;
+        }
+        record_load_sample();
+    }
+
+    // 탐색
+    /*
+     * 키가 존재하면 true를 반환합니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    bool find(int key) const
+    {
+        const auto &chain = table[Hashing(key)];
+        auto it = std::find(chain.begin(), chain.end(), key);
+        count_probes(chain, it);
+        return it != chain.end();
+    }
+
+    // 부하율 계산
+    float get_load_factor() const
+    {
+        return (float)numOfElements / bucketCount;
+    }
+
+    // 통계
+    /*
+     * 모든 버킷을 순회하며 체인 길이 분포와 메모리 사용량을 계산합니다.
+     * 시간 복잡도: O(n + b)
+     */
+    HashStats get_stats() const
+    {
+        HashStats stats;
+        stats.bucketCount = bucketCount;
+        stats.numOfElements = numOfElements;
+        stats.loadFactor = get_load_factor();
+        stats.maxChainLength = 0;
+        stats.loadFactorHistory = loadFactorHistory;
+        stats.loadSampleInterval = loadSampleInterval;
+
+        size_t bytes = sizeof(*this) +
+                       table.capacity() * sizeof(vector<int>) +
+                       loadFactorHistory.capacity() * sizeof(float);
+
+        for (const auto &chain : table)
+        {
+            int length = static_cast<int>(chain.size());
+            if (length >= (int)stats.chainLengthHistogram.size())
+            {
+                stats.chainLengthHistogram.resize(length + 1, 0);
+            }
+            stats.chainLengthHistogram[length]++;
+            stats.maxChainLength = max(stats.maxChainLength, length);
+            bytes += chain.capacity() * sizeof(int);
+        }
+
+        stats.bytesPerElement = numOfElements > 0 ? (double)bytes / numOfElements : 0.0;
+
+#ifdef HASH_COUNT_PROBES
+        stats.averageProbesPerLookup = lookupCount > 0 ? (double)probeCount / lookupCount : 0.0;
+#else
+        stats.averageProbesPerLookup = -1.0;
+#endif
+
+        return stats;
+    }
+
+    // 통계 출력
+    void display_stats() const
+    {
+        HashStats stats = get_stats();
+
+        cout << "버킷 수: " << stats.bucketCount
+             << ", 요소 수: " << stats.numOfElements
+             << ", 부하율: " << stats.loadFactor << '\n';
+
+        cout << "체인 길이 분포:";
+        for (size_t length = 0; length < stats.chainLengthHistogram.size(); ++length)
+        {
+            if (stats.chainLengthHistogram[length] > 0)
+            {
+                cout << " [" << length << "]=" << stats.chainLengthHistogram[length];
+            }
+        }
+        cout << "\n최대 체인 길이: " << stats.maxChainLength << '\n';
+        cout << "요소당 바이트: " << stats.bytesPerElement << '\n';
+
+        // 기록이 많으면 최대 16개만 골고루 골라 출력합니다.
+        size_t samples = stats.loadFactorHistory.size();
+        size_t step = max<size_t>(1, (samples + 15) / 16);
+        cout << "부하율 기록(" << stats.loadSampleInterval * step << "회 간격):";
+        for (size_t i = 0; i < samples; i += step)
+        {
+            cout << ' ' << stats.loadFactorHistory[i];
+        }
+        cout << '\n';
+
+        if (stats.averageProbesPerLookup >= 0)
+        {
+            cout << "탐색당 평균 비교 횟수: " << stats.averageProbesPerLookup << '\n';
         }
     }
 
@@ -80,6 +231,44 @@ public:
             cout << '\n';
         }
     }
+
+private:
+    // 찾은 위치까지 비교한 키의 수를 집계합니다. (HASH_COUNT_PROBES 정의 시에만 동작)
+    void count_probes(const vector<int> &chain, vector<int>::const_iterator it) const
+    {
+#ifdef HASH_COUNT_PROBES
+        lookupCount++;
+        probeCount += (it - chain.begin()) + (it != chain.end() ? 1 : 0);
+#else
+        (void)chain;
+        (void)it;
+#endif
+    }
+
+    // 부하율 기록
+    /*
+     * loadSampleInterval번의 삽입/삭제마다 부하율을 기록합니다.
+     */
+    void record_load_sample()
+    {
+        if (++opsSinceSample < loadSampleInterval)
+        {
+            return;
+        }
+
+        opsSinceSample = 0;
+        loadFactorHistory.push_back(get_load_factor());
+
+        if ((int)loadFactorHistory.size() == MAX_LOAD_SAMPLES)
+        {
+            for (int i = 0; i < MAX_LOAD_SAMPLES / 2; ++i)
+            {
+                loadFactorHistory[i] = loadFactorHistory[2 * i + 1];
+            }
+            loadFactorHistory.resize(MAX_LOAD_SAMPLES / 2);
+            loadSampleInterval *= 2;
+        }
+    }
 };
 
 int main()
@@ -95,5 +284,20 @@ int main()
     hash.delete_item(12);
     hash.display_hash();
 
+    // 통계 (버킷 1000개에 무작위 키 1만 개 삽입 후 1만 번 탐색)
+    mt19937 rng(42);
+    Hash large(1000);
+    for (int i = 0; i < 10000; ++i)
+    {
+        large.insert_item(rng() % 1000000000);
+    }
+    for (int i = 0; i < 10000; ++i)
+    {
+        large.find(rng() % 1000000000);
+    }
+
+    cout << "\n[통계]\n";
+    large.display_stats();
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,323 @@
+/**
+ * 락 스트라이핑(Lock Striping)을 사용한 동시성 해시 테이블
+ *
+ * 여러 스레드가 동시에 접근할 수 있도록 테이블을 여러 개의 세그먼트로
+ * 나누고, 세그먼트마다 독립적인 읽기/쓰기 락(shared_mutex)을 둡니다.
+ * 서로 다른 세그먼트에 접근하는 스레드들은 서로를 기다리지 않으며, 같은
+ * 세그먼트라도 읽기 연산끼리는 동시에 진행됩니다.
+ *
+ * 각 세그먼트는 체이닝과 리해싱을 사용하는 작은 해시 테이블이며, 부하율이
+ * 높아지면 해당 세그먼트만 리해싱합니다. 따라서 리해싱 중에도 다른
+ * 세그먼트에 대한 삽입과 삭제는 멈추지 않습니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <shared_mutex>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <cstdint>
+
+using namespace std;
+
+// 64비트 정수 섞기 (GenericHashMap.cpp 와 같은 구조)
+inline uint64_t mix64(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+class Hash
+{
+    // 세그먼트
+    /*
+     * 서로 다른 세그먼트의 락이 같은 캐시 라인을 공유하지 않도록
+     * 64바이트 단위로 정렬합니다(false sharing 방지).
+     */
+    struct alignas(64) Segment
+    {
+        mutable shared_mutex lock;
+        int bucketCount = 0;
+        vector<vector<int>> table;
+        int numOfElements = 0;
+    };
+
+    static constexpr float MAX_LOAD_FACTOR = 0.5f;
+
+    int segmentCount;
+    vector<Segment> segments;
+
+public:
+    Hash(int bucketCount, int segmentCount = 64)
+        : segmentCount(segmentCount),
+          segments(segmentCount)
+    {
+        int perSegment = max(1, bucketCount / segmentCount);
+        for (Segment &segment : segments)
+        {
+            segment.bucketCount = perSegment;
+            segment.table.resize(perSegment);
+        }
+    }
+
+    // 해시 함수
+    /*
+     * 키를 mix64로 섞은 뒤 상위 32비트는 세그먼트 선택에, 하위 32비트는
+     * 세그먼트 내부의 버킷 선택에 사용합니다. 곱셈만 하면 곱의 하위 비트가
+     * 키의 하위 비트에만 의존하므로, 일정한 간격의 키들이 몇 개의 버킷에
+     * 몰립니다.
+     */
+    static uint64_t Hashing(int key)
+    {
+        return mix64(static_cast<uint32_t>(key));
+    }
+
+    // 삽입
+    /*
+     * 키가 속한 세그먼트의 쓰기 락만 잡습니다.
+     * 이미 존재하는 키는 다시 삽입하지 않습니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    void insert_item(int key)
+    {
+        uint64_t h = Hashing(key);
+        Segment &segment = segment_for(h);
+        unique_lock<shared_mutex> guard(segment.lock);
+
+        auto &chain = segment.table[bucket_for(segment, h)];
+        if (std::find(chain.begin(), chain.end(), key) != chain.end())
+        {
+            return;
+        }
+
+        chain.push_back(key);
+        segment.numOfElements++;
+
+        if ((float)segment.numOfElements / segment.bucketCount > MAX_LOAD_FACTOR)
+        {
+            rehashing(segment);
+        }
+    }
+
+    // 삭제
+    /*
+     * 키가 속한 세그먼트의 쓰기 락만 잡고 체인에서 키를 삭제합니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    void delete_item(int key)
+    {
+        uint64_t h = Hashing(key);
+        Segment &segment = segment_for(h);
+        unique_lock<shared_mutex> guard(segment.lock);
+
+        auto &chain = segment.table[bucket_for(segment, h)];
+        auto it = std::find(chain.begin(), chain.end(), key);
+        if (it != chain.end())
+        {
+            chain.erase(it);
+            segment.numOfElements--;
+        }
+    }
+
+    // 탐색
+    /*
+     * 읽기 락(공유 락)을 사용하므로 읽기 연산끼리는 서로 막지 않습니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    bool find(int key) const
+    {
+        uint64_t h = Hashing(key);
+        const Segment &segment = segment_for(h);
+        shared_lock<shared_mutex> guard(segment.lock);
+
+        const auto &chain = segment.table[bucket_for(segment, h)];
+        return std::find(chain.begin(), chain.end(), key) != chain.end();
+    }
+
+    // 전체 요소 수
+    /*
+     * 세그먼트를 하나씩 잠그며 합산하므로, 다른 스레드가 동시에 수정하는
+     * 중이라면 근사값입니다.
+     */
+    int size() const
+    {
+        int total = 0;
+        for (const Segment &segment : segments)
+        {
+            shared_lock<shared_mutex> guard(segment.lock);
+            total += segment.numOfElements;
+        }
+        return total;
+    }
+
+    // 가장 긴 체인의 길이 (키 분포 확인용)
+    int max_chain_length() const
+    {
+        size_t longest = 0;
+        for (const Segment &segment : segments)
+        {
+            shared_lock<shared_mutex> guard(segment.lock);
+            for (const auto &chain : segment.table)
+            {
+                longest = max(longest, chain.size());
+            }
+        }
+        return static_cast<int>(longest);
+    }
+
+private:
+    Segment &segment_for(uint64_t h)
+    {
+        return segments[(h >> 32) % segmentCount];
+    }
+
+    const Segment &segment_for(uint64_t h) const
+    {
+        return segments[(h >> 32) % segmentCount];
+    }
+
+    static int bucket_for(const Segment &segment, uint64_t h)
+    {
+        return static_cast<uint32_t>(h) % segment.bucketCount;
+    }
+
+    // 세그먼트 리해싱
+    /*
+     * 호출자가 해당 세그먼트의 쓰기 락을 잡고 있어야 합니다.
+     * 세그먼트의 버킷 수를 2배로 늘리고 키들을 재배치합니다.
+     * 시간 복잡도: O(세그먼트의 요소 수)
+     */
+    static void rehashing(Segment &segment)
+    {
+        segment.bucketCount *= 2;
+        vector<vector<int>> oldTable(segment.bucketCount);
+        oldTable.swap(segment.table);
+
+        for (const auto &chain : oldTable)
+        {
+            for (int key : chain)
+            {
+                segment.table[bucket_for(segment, Hashing(key))].push_back(key);
+            }
+        }
+    }
+};
+
+// 처리량 측정
+/*
+ * threadCount개의 스레드가 각각 opsPerThread번의 연산을 수행합니다.
+ * readPercent% 는 탐색, 나머지는 삽입과 삭제를 번갈아 수행합니다.
+ * @return 초당 연산 수(백만 단위)
+ */
+double measure_throughput(int threadCount, int readPercent, int keyRange, int opsPerThread)
+{
+    Hash hash(keyRange);
+    for (int key = 0; key < keyRange; key += 2)
+    {
+        hash.insert_item(key);
+    }
+
+    vector<thread> workers;
+    auto start = chrono::steady_clock::now();
+
+    for (int t = 0; t < threadCount; ++t)
+    {
+        workers.emplace_back([&hash, t, readPercent, keyRange, opsPerThread]
+                             {
+            mt19937 rng(t + 1);
+            for (int i = 0; i < opsPerThread; ++i)
+            {
+                int key = rng() % keyRange;
+                if ((int)(rng() % 100) < readPercent)
+                {
+                    hash.find(key);
+                }
+                else if (i & 1)
+                {
+                    hash.insert_item(key);
+                }
+                else
+                {
+                    hash.delete_item(key);
+                }
+            } });
+    }
+
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return (double)threadCount * opsPerThread / elapsed.count() / 1e6;
+}
+
+int main()
+{
+    Hash hash(16, 4);
+
+    // 4개의 스레드가 서로 다른 범위의 키를 동시에 삽입합니다.
+    vector<thread> writers;
+    for (int t = 0; t < 4; ++t)
+    {
+        writers.emplace_back([&hash, t]
+                             {
+            for (int key = t * 1000; key < (t + 1) * 1000; ++key)
+            {
+                hash.insert_item(key);
+            } });
+    }
+    for (thread &writer : writers)
+    {
+        writer.join();
+    }
+
+    cout << "동시 삽입 후 요소 수: " << hash.size() << '\n';
+
+    hash.delete_item(1500);
+    cout << "1500 탐색: " << (hash.find(1500) ? "있음" : "없음") << '\n';
+    cout << "2500 탐색: " << (hash.find(2500) ? "있음" : "없음") << '\n';
+
+    // 일정한 간격의 키도 버킷에 고르게 퍼지는지 확인합니다.
+    cout << "\n[키 100000개의 가장 긴 체인]\n";
+    for (int stride : {1, 1024, 16384})
+    {
+        Hash strided(1 << 16, 64);
+        for (int i = 0; i < 100000; ++i)
+        {
+            strided.insert_item(i * stride);
+        }
+        cout << "간격 " << stride << ": " << strided.max_chain_length() << '\n';
+    }
+
+    // 스레드 수와 읽기 비율에 따른 처리량
+    int maxThreads = max(1u, thread::hardware_concurrency());
+    int readRatios[] = {50, 90, 99};
+
+    cout << "\n[처리량 벤치마크 (Mops/s)]\n";
+    for (int threads = 1;; threads = min(threads * 2, maxThreads))
+    {
+        cout << "스레드 " << threads << "개:";
+        for (int readPercent : readRatios)
+        {
+            cout << "  읽기 " << readPercent << "% = "
+                 << measure_throughput(threads, readPercent, 1 << 20, 200000);
+        }
+        cout << '\n';
+
+        if (threads == maxThreads)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
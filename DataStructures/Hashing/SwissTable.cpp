@@ -0,0 +1,479 @@
+/**
+ * 스위스 테이블(Swiss Table) 방식의 해시 테이블
+ *
+ * 오픈 어드레싱 해시 테이블로, 키 배열과 별도로 슬롯마다 1바이트짜리
+ * 제어 바이트(control byte)를 유지합니다. 제어 바이트에는 슬롯의 상태
+ * (비어있음/삭제됨)나 해시값의 하위 7비트(태그, h2)가 저장됩니다.
+ *
+ * 슬롯 16개를 하나의 그룹으로 묶고, 탐색 시 그룹의 제어 바이트 16개를
+ * SIMD(SSE2) 비교 명령 한 번으로 태그와 비교합니다. 태그가 일치하는
+ * 슬롯만 실제 키를 비교하므로, 특히 찾는 키가 없는 경우(miss)에 키 배열을
+ * 거의 읽지 않고 탐색을 끝낼 수 있습니다.
+ *
+ * SSE2를 사용할 수 없는 환경에서는 컴파일 시점에 스칼라 구현으로
+ * 대체됩니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SWISS_TABLE_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+class Hash
+{
+    static constexpr int GROUP_WIDTH = 16;
+
+    // 제어 바이트 값
+    /*
+     * EMPTY   : 0b10000000 (비어있음, 탐색 종료 조건)
+     * DELETED : 0b11111110 (삭제됨, 탐색은 계속 진행)
+     * 그 외   : 0b0xxxxxxx (사용 중, 하위 7비트는 해시 태그)
+     */
+    static constexpr int8_t EMPTY = -128;
+    static constexpr int8_t DELETED = -2;
+
+    static constexpr float MAX_LOAD_FACTOR = 0.875f;
+
+    int groupCount;
+    vector<int8_t> ctrl;
+    vector<int> slots;
+
+    int numOfElements;
+    int numOfDeleted;
+
+public:
+    Hash(int bucketCount) : groupCount(group_count_for(bucketCount)),
+                            ctrl(groupCount * GROUP_WIDTH, EMPTY),
+                            slots(groupCount * GROUP_WIDTH),
+                            numOfElements(0),
+                            numOfDeleted(0) {}
+
+    // 해시 함수
+    /*
+     * 64비트 곱셈과 시프트로 키를 섞습니다. 하위 7비트는 태그(h2)로,
+     * 나머지 상위 비트는 그룹 위치(h1)로 사용합니다.
+     */
+    static uint64_t Hashing(int key)
+    {
+        uint64_t h = static_cast<uint32_t>(key);
+        h *= 0x9E3779B97F4A7C15ull;
+        return h ^ (h >> 32);
+    }
+
+    // 삽입
+    /*
+     * 이미 존재하는 키는 다시 삽입하지 않습니다.
+     * 탐사 순서상 처음 만나는 빈 슬롯(또는 삭제된 슬롯)에 키를 저장합니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    void insert_item(int key)
+    {
+        if (find(key))
+        {
+            return;
+        }
+
+        if (numOfElements + numOfDeleted + 1 > MAX_LOAD_FACTOR * capacity())
+        {
+            rehashing();
+        }
+
+        insert_unique(key);
+    }
+
+    // 삭제
+    /*
+     * 그룹 안에 빈 슬롯이 남아 있다면 이 그룹을 지나쳐 탐사가 이어지는
+     * 일이 없으므로 슬롯을 바로 EMPTY로 되돌립니다. 그렇지 않다면
+     * DELETED(묘비)로 표시해 뒤쪽 키의 탐사 경로를 유지합니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    void delete_item(int key)
+    {
+        int index = find_index(key);
+        if (index == -1)
+        {
+            return;
+        }
+
+        int group = index / GROUP_WIDTH * GROUP_WIDTH;
+        if (match_empty(&ctrl[group]) != 0)
+        {
+            ctrl[index] = EMPTY;
+        }
+        else
+        {
+            ctrl[index] = DELETED;
+            numOfDeleted++;
+        }
+        numOfElements--;
+    }
+
+    // 탐색
+    /*
+     * 그룹 단위로 태그를 비교하고, 일치하는 슬롯의 키만 확인합니다.
+     * 그룹에 빈 슬롯이 하나라도 있으면 키가 없는 것으로 판단합니다.
+     * 시간 복잡도: 평균 O(1), 최악 O(n)
+     */
+    bool find(int key) const
+    {
+        return find_index(key) != -1;
+    }
+
+    // 리해싱
+    /*
+     * 삭제 표시가 많아 공간이 부족한 경우에는 같은 크기로, 실제 요소가
+     * 많은 경우에는 2배 크기로 테이블을 다시 구성합니다.
+     * 시간 복잡도: O(n)
+     */
+    void rehashing()
+    {
+        int newGroupCount = groupCount;
+        if (numOfElements + 1 > MAX_LOAD_FACTOR * capacity() / 2)
+        {
+            newGroupCount *= 2;
+        }
+
+        vector<int8_t> oldCtrl(newGroupCount * GROUP_WIDTH, EMPTY);
+        vector<int> oldSlots(newGroupCount * GROUP_WIDTH);
+        oldCtrl.swap(ctrl);
+        oldSlots.swap(slots);
+
+        groupCount = newGroupCount;
+        numOfElements = 0;
+        numOfDeleted = 0;
+
+        for (size_t i = 0; i < oldCtrl.size(); ++i)
+        {
+            if (oldCtrl[i] >= 0)
+            {
+                insert_unique(oldSlots[i]);
+            }
+        }
+    }
+
+    // 부하율 계산
+    float get_load_factor() const
+    {
+        return (float)numOfElements / capacity();
+    }
+
+    // 출력
+    /*
+     * 그룹 단위로 사용 중인 슬롯의 값을 출력합니다.
+     * 시간 복잡도: O(b) (b: 슬롯의 수)
+     */
+    void display_hash() const
+    {
+        for (int g = 0; g < groupCount; ++g)
+        {
+            cout << "그룹 " << g << ":";
+            for (int i = g * GROUP_WIDTH; i < (g + 1) * GROUP_WIDTH; ++i)
+            {
+                if (ctrl[i] >= 0)
+                {
+                    cout << ' ' << slots[i];
+                }
+                else
+                {
+                    cout << (ctrl[i] == EMPTY ? " ." : " x");
+                }
+            }
+            cout << '\n';
+        }
+    }
+
+private:
+    int capacity() const
+    {
+        return groupCount * GROUP_WIDTH;
+    }
+
+    int find_index(int key) const
+    {
+        uint64_t h = Hashing(key);
+        int8_t tag = static_cast<int8_t>(h & 0x7F);
+        int mask = groupCount - 1;
+        int group = static_cast<int>(h >> 7) & mask;
+
+        // 삼각수 간격으로 그룹을 탐사하며, 그룹 수가 2의 거듭제곱이므로
+        // 모든 그룹을 한 번씩 방문합니다.
+        for (int step = 1; step <= groupCount; ++step)
+        {
+            const int8_t *base = &ctrl[group * GROUP_WIDTH];
+
+            for (uint32_t bits = match(base, tag); bits != 0; bits &= bits - 1)
+            {
+                int index = group * GROUP_WIDTH + count_trailing_zeros(bits);
+                if (slots[index] == key)
+                {
+                    return index;
+                }
+            }
+
+            if (match_empty(base) != 0)
+            {
+                return -1;
+            }
+
+            group = (group + step) & mask;
+        }
+
+        return -1;
+    }
+
+    // 키가 테이블에 없다고 가정하고 첫 번째 빈(또는 삭제된) 슬롯에 저장합니다.
+    void insert_unique(int key)
+    {
+        uint64_t h = Hashing(key);
+        int mask = groupCount - 1;
+        int group = static_cast<int>(h >> 7) & mask;
+
+        for (int step = 1;; ++step)
+        {
+            uint32_t bits = match_empty_or_deleted(&ctrl[group * GROUP_WIDTH]);
+            if (bits != 0)
+            {
+                int index = group * GROUP_WIDTH + count_trailing_zeros(bits);
+                if (ctrl[index] == DELETED)
+                {
+                    numOfDeleted--;
+                }
+
+                ctrl[index] = static_cast<int8_t>(h & 0x7F);
+                slots[index] = key;
+                numOfElements++;
+                return;
+            }
+
+            group = (group + step) & mask;
+        }
+    }
+
+    // 그룹 비교 연산
+    /*
+     * 제어 바이트 16개를 한 번에 비교해, 조건을 만족하는 슬롯의 위치를
+     * 비트마스크(하위 16비트)로 반환합니다.
+     */
+#ifdef SWISS_TABLE_USE_SSE2
+    static uint32_t match(const int8_t *group, int8_t tag)
+    {
+        __m128i ctrlBytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), ctrlBytes));
+    }
+
+    static uint32_t match_empty(const int8_t *group)
+    {
+        return match(group, EMPTY);
+    }
+
+    // EMPTY와 DELETED는 -1보다 작은 유일한 값입니다.
+    static uint32_t match_empty_or_deleted(const int8_t *group)
+    {
+        __m128i ctrlBytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+        return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrlBytes));
+    }
+#else
+    static uint32_t match(const int8_t *group, int8_t tag)
+    {
+        uint32_t bits = 0;
+        for (int i = 0; i < GROUP_WIDTH; ++i)
+        {
+            bits |= static_cast<uint32_t>(group[i] == tag) << i;
+        }
+        return bits;
+    }
+
+    static uint32_t match_empty(const int8_t *group)
+    {
+        return match(group, EMPTY);
+    }
+
+    static uint32_t match_empty_or_deleted(const int8_t *group)
+    {
+        uint32_t bits = 0;
+        for (int i = 0; i < GROUP_WIDTH; ++i)
+        {
+            bits |= static_cast<uint32_t>(group[i] < -1) << i;
+        }
+        return bits;
+    }
+#endif
+
+    static int count_trailing_zeros(uint32_t bits)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, bits);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(bits);
+#endif
+    }
+
+    static int group_count_for(int bucketCount)
+    {
+        int count = 1;
+        while (count * GROUP_WIDTH < bucketCount)
+        {
+            count <<= 1;
+        }
+        return count;
+    }
+};
+
+// 비교용 체이닝 해시 테이블
+/*
+ * SimpleChaining.cpp, ChainingWithRehasing.cpp 와 같은 구조입니다.
+ * rehash가 false이면 버킷 수가 고정된 단순 체이닝으로 동작합니다.
+ */
+class ChainingHash
+{
+    int bucketCount;
+    vector<vector<int>> table;
+    int numOfElements;
+    bool rehash;
+
+    static constexpr float MAX_LOAD_FACTOR = 0.5f;
+
+public:
+    ChainingHash(int bucketCount, bool rehash) : bucketCount(bucketCount),
+                                                 table(bucketCount),
+                                                 numOfElements(0),
+                                                 rehash(rehash) {}
+
+    void insert_item(int key)
+    {
+        if (rehash && (float)numOfElements / bucketCount > MAX_LOAD_FACTOR)
+        {
+            bucketCount *= 2;
+            vector<vector<int>> oldTable(bucketCount);
+            oldTable.swap(table);
+            for (const auto &chain : oldTable)
+            {
+                for (int k : chain)
+                {
+                    table[Hashing(k)].push_back(k);
+                }
+            }
+        }
+
+        table[Hashing(key)].push_back(key);
+        numOfElements++;
+    }
+
+    bool find(int key) const
+    {
+        const auto &chain = table[Hashing(key)];
+        return std::find(chain.begin(), chain.end(), key) != chain.end();
+    }
+
+private:
+    int Hashing(int key) const
+    {
+        return static_cast<uint32_t>(key) % bucketCount;
+    }
+};
+
+// 함수 실행 시간을 밀리초 단위로 측정합니다.
+template <typename F>
+long long measure_ms(F f)
+{
+    auto start = chrono::steady_clock::now();
+    f();
+    auto elapsed = chrono::steady_clock::now() - start;
+    return chrono::duration_cast<chrono::milliseconds>(elapsed).count();
+}
+
+// 삽입, 성공 탐색(hit), 실패 탐색(miss) 시간을 출력합니다.
+template <typename Table, typename Insert, typename Find>
+void benchmark(const char *name, Table &table, const vector<int> &keys,
+               const vector<int> &missKeys, Insert insert, Find find)
+{
+    long long found = 0;
+
+    long long insertMs = measure_ms([&]
+                                    { for (int key : keys) insert(table, key); });
+    long long hitMs = measure_ms([&]
+                                 { for (int key : keys) found += find(table, key); });
+    long long missMs = measure_ms([&]
+                                  { for (int key : missKeys) found += find(table, key); });
+
+    cout << name << " - 삽입: " << insertMs << "ms, hit: " << hitMs
+         << "ms, miss: " << missMs << "ms (찾은 키 " << found << "개)\n";
+}
+
+int main()
+{
+    vector<int> keys = {15, 11, 27, 8, 12};
+
+    Hash hash(16);
+    for (int key : keys)
+    {
+        hash.insert_item(key);
+    }
+
+    hash.delete_item(12);
+    hash.display_hash();
+
+    cout << "\n27 탐색: " << (hash.find(27) ? "있음" : "없음") << '\n';
+    cout << "12 탐색: " << (hash.find(12) ? "있음" : "없음") << '\n';
+
+#ifdef SWISS_TABLE_USE_SSE2
+    cout << "\n그룹 비교: SSE2\n";
+#else
+    cout << "\n그룹 비교: 스칼라\n";
+#endif
+
+    // 벤치마크
+    /*
+     * 홀수 곱셈은 2^32 위에서 전단사이므로 서로 다른 키가 만들어집니다.
+     * 앞쪽 N개는 삽입하고, 뒤쪽 N개는 실패 탐색에 사용합니다.
+     */
+    const int N = 1000000;
+    vector<int> benchKeys;
+    vector<int> missKeys;
+    for (int i = 0; i < 2 * N; ++i)
+    {
+        int key = static_cast<int>(static_cast<uint32_t>(i) * 2654435761u);
+        (i < N ? benchKeys : missKeys).push_back(key);
+    }
+
+    cout << "\n[벤치마크: 키 " << N << "개]\n";
+
+    Hash swiss(16);
+    benchmark("SwissTable          ", swiss, benchKeys, missKeys,
+              [](Hash &t, int k) { t.insert_item(k); },
+              [](const Hash &t, int k) { return t.find(k); });
+
+    ChainingHash simple(N, false);
+    benchmark("SimpleChaining      ", simple, benchKeys, missKeys,
+              [](ChainingHash &t, int k) { t.insert_item(k); },
+              [](const ChainingHash &t, int k) { return t.find(k); });
+
+    ChainingHash rehashing(7, true);
+    benchmark("ChainingWithRehasing", rehashing, benchKeys, missKeys,
+              [](ChainingHash &t, int k) { t.insert_item(k); },
+              [](const ChainingHash &t, int k) { return t.find(k); });
+
+    unordered_map<int, int> um;
+    benchmark("unordered_map       ", um, benchKeys, missKeys,
+              [](unordered_map<int, int> &t, int k) { t[k] = k; },
+              [](const unordered_map<int, int> &t, int k) { return t.count(k) > 0; });
+
+    return 0;
+}
@@ -0,0 +1,393 @@
+/*
+ * 작업 훔치기 덱 (Chase-Lev Work-Stealing Deque)
+ *
+ * 작업 훔치기(work stealing) 스케줄러는 작업자 스레드마다 덱을 하나씩 둡니다.
+ * - 덱의 주인(owner)은 자기 덱의 뒤쪽(rear)에 작업을 넣고 뒤쪽에서 꺼냅니다.
+ *   가장 최근에 만든 작업을 먼저 처리하므로 캐시에 남은 데이터를 재사용합니다.
+ * - 할 일이 없는 다른 스레드(thief)는 남의 덱의 앞쪽(front)에서 작업을
+ *   훔칩니다. 가장 오래된 작업은 보통 가장 큰 작업이라 훔치는 횟수가 줄어듭니다.
+ *
+ * 원형 덱(CircularDeque.cpp)과 같은 원형 배열을 사용하되, 위치는 계속 증가하는
+ * 값(top = 앞, bottom = 뒤)으로 두고 배열에 접근할 때만 나머지를 구합니다.
+ * - 주인만 bottom 을 수정하므로 add_rear 는 락도 CAS 도 없이 동작합니다.
+ * - thief 들은 top 을 CAS 로 한 칸 옮겨 작업을 차지합니다.
+ * - remove_rear 는 마지막 하나가 남았을 때만 thief 와 경쟁하며, 이때만 CAS 를
+ *   사용합니다.
+ *
+ * 배열이 가득 차면 주인이 두 배 크기의 배열에 복사한 뒤 교체합니다. thief 는
+ * 이전 배열을 읽고 있을 수도 있으므로 이전 배열은 덱이 소멸될 때 해제합니다.
+ * (배열 크기가 두 배씩 늘어나므로 이전 배열들의 합은 현재 배열보다 작습니다)
+ *
+ * 요소는 원자적으로 읽고 쓸 수 있어야 하므로 포인터나 정수처럼 단순한
+ * 타입(trivially copyable)만 저장합니다.
+ *
+ */
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <stdexcept>
+
+using namespace std;
+
+template <typename T>
+class Deque
+{
+    static_assert(is_trivially_copyable<T>::value, "Deque element must be trivially copyable");
+
+    static constexpr size_t CACHE_LINE = 64;
+
+    // 원형 배열 (크기는 2의 거듭제곱)
+    struct Array
+    {
+        int64_t capacity;
+        int64_t mask;
+        unique_ptr<atomic<T>[]> slots;
+
+        explicit Array(int64_t c) : capacity(c), mask(c - 1), slots(new atomic<T>[c])
+        {
+        }
+
+        T get(int64_t index)
+        {
+            return slots[index & mask].load(memory_order_relaxed);
+        }
+
+        void put(int64_t index, T value)
+        {
+            slots[index & mask].store(value, memory_order_relaxed);
+        }
+    };
+
+    alignas(CACHE_LINE) atomic<int64_t> top;    // thief 가 훔칠 위치
+    alignas(CACHE_LINE) atomic<int64_t> bottom; // 주인이 다음에 넣을 위치
+    atomic<Array *> array;
+    vector<unique_ptr<Array>> arrays; // 지금까지 만든 배열 (주인만 수정)
+
+public:
+    // 처음 용량은 c 이상인 가장 작은 2의 거듭제곱으로 정해집니다.
+    explicit Deque(int64_t c = 64) : top(0), bottom(0)
+    {
+        if (c <= 0)
+        {
+            throw invalid_argument("Capacity must be positive");
+        }
+
+        int64_t capacity = 1;
+        while (capacity < c)
+        {
+            capacity <<= 1;
+        }
+        arrays.emplace_back(new Array(capacity));
+        array.store(arrays.back().get(), memory_order_relaxed);
+    }
+
+    Deque(const Deque &) = delete;
+    Deque &operator=(const Deque &) = delete;
+
+    // 뒤쪽 삽입 (주인 전용)
+    /*
+     * 가득 찼다면 배열을 두 배로 늘립니다. 값을 쓴 뒤 bottom 을 공개하므로
+     * thief 는 완전히 쓰인 값만 봅니다.
+     * 시간 복잡도: 분할 상환 O(1)
+     */
+    void add_rear(T new_data)
+    {
+        int64_t b = bottom.load(memory_order_relaxed);
+        int64_t t = top.load(memory_order_acquire);
+        Array *a = array.load(memory_order_relaxed);
+
+        if (b - t > a->capacity - 1)
+        {
+            a = grow(a, b, t);
+        }
+
+        a->put(b, new_data);
+        atomic_thread_fence(memory_order_release);
+        bottom.store(b + 1, memory_order_relaxed);
+    }
+
+    // 뒤쪽 삭제 (주인 전용)
+    /*
+     * 먼저 bottom 을 줄여 마지막 칸을 예약한 뒤 top 을 확인합니다.
+     * 남은 요소가 하나뿐이면 같은 칸을 노리는 thief 와 top 을 CAS 로 겨룹니다.
+     * 비어있거나 thief 에게 졌다면 false 를 반환합니다.
+     * 시간 복잡도: O(1)
+     */
+    bool remove_rear(T &out)
+    {
+        int64_t b = bottom.load(memory_order_relaxed) - 1;
+        Array *a = array.load(memory_order_relaxed);
+        bottom.store(b, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        int64_t t = top.load(memory_order_relaxed);
+
+        if (t > b)
+        {
+            // 비어 있습니다.
+            bottom.store(b + 1, memory_order_relaxed);
+            return false;
+        }
+
+        out = a->get(b);
+        if (t < b)
+        {
+            // 두 개 이상 남아 있어 thief 와 겹치지 않습니다.
+            return true;
+        }
+
+        bool won = top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+        bottom.store(b + 1, memory_order_relaxed);
+        return won;
+    }
+
+    // 앞쪽에서 훔치기 (다른 스레드)
+    /*
+     * top 위치의 값을 읽은 뒤 top 을 CAS 로 옮깁니다. 비어있거나 다른 스레드에게
+     * 졌다면 false 를 반환하므로, 다른 덱에서 훔치거나 다시 시도하면 됩니다.
+     * 시간 복잡도: O(1)
+     */
+    bool steal_front(T &out)
+    {
+        int64_t t = top.load(memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        int64_t b = bottom.load(memory_order_acquire);
+
+        if (t >= b)
+        {
+            return false;
+        }
+
+        Array *a = array.load(memory_order_acquire);
+        T value = a->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+        {
+            return false;
+        }
+
+        out = value;
+        return true;
+    }
+
+    // 다른 스레드가 동시에 수정 중일 수 있으므로 대략적인 값입니다.
+    int64_t size_approx() const
+    {
+        int64_t b = bottom.load(memory_order_relaxed);
+        int64_t t = top.load(memory_order_relaxed);
+        return b > t ? b - t : 0;
+    }
+
+    bool is_empty() const
+    {
+        return size_approx() == 0;
+    }
+
+    int64_t get_capacity() const
+    {
+        return array.load(memory_order_relaxed)->capacity;
+    }
+
+private:
+    // 두 배 크기의 배열에 top ~ bottom 구간을 복사해 교체합니다. (주인 전용)
+    /*
+     * 위치 값은 그대로 두므로 같은 위치가 새 배열에서는 다른 칸에 놓일 뿐,
+     * thief 가 보는 top/bottom 의 의미는 바뀌지 않습니다.
+     */
+    Array *grow(Array *old, int64_t b, int64_t t)
+    {
+        arrays.emplace_back(new Array(old->capacity * 2));
+        Array *a = arrays.back().get();
+        for (int64_t i = t; i < b; i++)
+        {
+            a->put(i, old->get(i));
+        }
+
+        array.store(a, memory_order_release);
+        return a;
+    }
+};
+
+// 비교용: 뮤텍스로 감싼 원형 덱 (CircularDeque.cpp 와 같은 구조)
+class LockedCircularDeque
+{
+    int *arr;
+    int front;
+    int size;
+    int capacity;
+    mutex lock;
+
+public:
+    LockedCircularDeque(int c)
+    {
+        arr = new int[c];
+        front = 0;
+        size = 0;
+        capacity = c;
+    }
+
+    ~LockedCircularDeque()
+    {
+        delete[] arr;
+    }
+
+    void add_rear(int new_data)
+    {
+        lock_guard<mutex> guard(lock);
+        if (size == capacity)
+        {
+            throw runtime_error("Deque Overflow");
+        }
+        arr[(front + size) % capacity] = new_data;
+        size++;
+    }
+
+    bool remove_rear(int &out)
+    {
+        lock_guard<mutex> guard(lock);
+        if (size == 0)
+        {
+            return false;
+        }
+        out = arr[(front + size - 1) % capacity];
+        size--;
+        return true;
+    }
+
+    bool steal_front(int &out)
+    {
+        lock_guard<mutex> guard(lock);
+        if (size == 0)
+        {
+            return false;
+        }
+        out = arr[front];
+        front = (front + 1) % capacity;
+        size--;
+        return true;
+    }
+};
+
+// 주인이 작업을 넣고 꺼내는 동안 thief 들이 훔치는 시뮬레이션
+/*
+ * 주인은 rounds 번 동안 작업 batch 개를 넣고 꺼낼 수 있는 만큼 꺼내며, thief 들은
+ * 계속 훔칩니다. 모든 작업이 정확히 한 번씩 처리되었는지 합계로 확인합니다.
+ * @return 경과 시간(밀리초)
+ */
+template <typename D>
+double simulate(D &dq, int thieves, int rounds, int batch, long long &processed, long long &stolen)
+{
+    atomic<bool> done(false);
+    atomic<long long> stolenCount(0);
+    atomic<long long> sum(0);
+    vector<thread> workers;
+
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < thieves; i++)
+    {
+        workers.emplace_back([&]
+            {
+                long long local = 0;
+                long long count = 0;
+                int value;
+                while (!done.load(memory_order_acquire))
+                {
+                    if (dq.steal_front(value))
+                    {
+                        local += value;
+                        count++;
+                    }
+                    else
+                    {
+                        this_thread::yield();
+                    }
+                }
+                while (dq.steal_front(value))
+                {
+                    local += value;
+                    count++;
+                }
+                sum += local;
+                stolenCount += count;
+            });
+    }
+
+    long long local = 0;
+    int value;
+    for (int r = 0; r < rounds; r++)
+    {
+        for (int i = 0; i < batch; i++)
+        {
+            dq.add_rear(1);
+        }
+        while (dq.remove_rear(value))
+        {
+            local += value;
+        }
+    }
+    done.store(true, memory_order_release);
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+
+    processed = local + sum;
+    stolen = stolenCount;
+    return elapsed.count();
+}
+
+int main()
+{
+    Deque<int> dq(4);
+
+    cout << "뒤쪽에 10, 20, 30, 40, 50 추가 (처음 용량 " << dq.get_capacity() << ")" << endl;
+    for (int value : { 10, 20, 30, 40, 50 })
+    {
+        dq.add_rear(value);
+    }
+    cout << "현재 용량: " << dq.get_capacity() << endl;
+
+    int value;
+    dq.steal_front(value);
+    cout << "\n앞쪽에서 훔친 값: " << value << endl;
+    dq.remove_rear(value);
+    cout << "뒤쪽에서 꺼낸 값: " << value << endl;
+
+    cout << "\n덱에서 남은 값들을 모두 꺼냅니다..." << endl;
+    while (dq.remove_rear(value))
+    {
+        cout << "뒤 제거: " << value << endl;
+    }
+    cout << "덱이 비어있습니까?: " << (dq.is_empty() ? "네" : "아니오") << endl;
+
+    // 벤치마크
+    /*
+     * 코어가 하나뿐인 환경에서는 스레드들이 번갈아 실행되므로 확장성은 보이지
+     * 않습니다.
+     */
+    const int ROUNDS = 20000;
+    const int BATCH = 100;
+
+    cout << "\n[주인 작업 " << ROUNDS * BATCH << "개, 코어 " << thread::hardware_concurrency() << "개]\n";
+    for (int thieves : { 0, 1, 3 })
+    {
+        long long processed, stolen;
+
+        Deque<int> lockFree(BATCH);
+        double lockFreeMs = simulate(lockFree, thieves, ROUNDS, BATCH, processed, stolen);
+        cout << "thief " << thieves << "명 - Chase-Lev: " << lockFreeMs << "ms (처리 " << processed
+             << ", 훔침 " << stolen << ")";
+
+        LockedCircularDeque locked(BATCH);
+        double lockedMs = simulate(locked, thieves, ROUNDS, BATCH, processed, stolen);
+        cout << ", 뮤텍스 원형 덱: " << lockedMs << "ms (처리 " << processed << ", 훔침 " << stolen << ")\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,440 @@
+/*
+ * d-진 힙 기반 우선순위 큐 (d-ary Heap)
+ *
+ * 이진 힙은 자식이 2개이므로 높이가 log2(n)입니다. d-진 힙은 노드마다 자식을
+ * d개 두어 높이를 log_d(n)으로 줄입니다. 한 노드의 자식들은 배열에서
+ * 연속으로 놓이므로, d = 4 또는 8 이면 int 형 형제 노드들이 한 캐시 라인(64바이트)
+ * 안에 들어가 shift_down 한 단계에서 여러 자식을 비교하는 비용이 작습니다.
+ *
+ * 재정렬할 때는 매 단계 swap 하는 대신, 이동할 값을 따로 보관하고 빈 자리(hole)
+ * 만 옮긴 뒤 마지막에 한 번 값을 씁니다. 단계마다 쓰기가 3번에서 1번으로 줄어듭니다.
+ *
+ * 범위로부터 힙을 만들 때는 요소를 하나씩 삽입(O(n log n))하지 않고,
+ * 마지막 내부 노드부터 루트까지 shift_down 하는 플로이드(Floyd)의 상향식
+ * 구성으로 O(n)에 만듭니다.
+ *
+ * 비교 함수는 std::priority_queue 와 같은 규칙을 따릅니다.
+ * less<T>(기본값)는 최대 힙, greater<T>는 최소 힙입니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <functional>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <random>
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+template <typename T, int D = 4, typename Compare = less<T>>
+class PriorityQueue
+{
+	static_assert(D >= 2, "D must be at least 2");
+
+	vector<T> pq;
+	Compare compare;
+
+public:
+	PriorityQueue() = default;
+
+	// 범위로부터 힙 구성
+	/*
+	 * 시간 복잡도: O(n)
+	 */
+	template <typename It>
+	PriorityQueue(It first, It last) : pq(first, last)
+	{
+		heapify();
+	}
+
+	void enqueue(const T& value)
+	{
+		pq.push_back(value);
+		shift_up(pq.size() - 1);
+	}
+
+	// 여러 요소를 한 번에 삽입
+	/*
+	 * k개를 하나씩 삽입하는 비용은 약 k * log_d(n + k), 뒤에 붙인 뒤 힙 전체를
+	 * 다시 구성하는 비용은 약 n + k 이므로 더 싼 쪽을 선택합니다.
+	 */
+	template <typename It>
+	void push_range(It first, It last)
+	{
+		size_t old_size = pq.size();
+		pq.insert(pq.end(), first, last);
+
+		size_t added = pq.size() - old_size;
+		double height = log((double)pq.size() + 1) / log((double)D);
+
+		if (added * height > pq.size())
+		{
+			heapify();
+		}
+		else
+		{
+			for (size_t i = old_size; i < pq.size(); i++)
+			{
+				shift_up(i);
+			}
+		}
+	}
+
+	void dequeue()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue Underflow");
+		}
+
+		T last = move(pq.back());
+		pq.pop_back();
+
+		if (!pq.empty())
+		{
+			size_t hole = sink_hole(0);
+			pq[hole] = move(last);
+			shift_up(hole);
+		}
+	}
+
+	const T& peek() const
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue is empty");
+		}
+		return pq[0];
+	}
+
+	bool is_empty() const
+	{
+		return pq.empty();
+	}
+
+	size_t size() const
+	{
+		return pq.size();
+	}
+
+	void reserve(size_t capacity)
+	{
+		pq.reserve(capacity);
+	}
+
+private:
+	// 현재 노드의 부모 노드를 계산합니다.
+	static size_t parent(size_t index)
+	{
+		return (index - 1) / D;
+	}
+
+	// 현재 노드의 첫 번째 자식 노드를 계산합니다.
+	static size_t first_child(size_t index)
+	{
+		return D * index + 1;
+	}
+
+	// 플로이드의 상향식 힙 구성
+	/*
+	 * 잎 노드는 이미 힙이므로, 마지막 내부 노드부터 루트까지 거꾸로
+	 * shift_down 합니다. 대부분의 노드가 잎에 가까워 이동 거리가 짧으므로
+	 * 전체 비용은 O(n)입니다.
+	 */
+	void heapify()
+	{
+		if (pq.size() < 2)
+		{
+			return;
+		}
+
+		for (size_t i = parent(pq.size() - 1) + 1; i-- > 0;)
+		{
+			shift_down(i, move(pq[i]));
+		}
+	}
+
+	// 부모보다 우선순위가 높은 동안 빈 자리를 위로 옮깁니다.
+	void shift_up(size_t index)
+	{
+		T value = move(pq[index]);
+
+		while (index > 0 && compare(pq[parent(index)], value))
+		{
+			pq[index] = move(pq[parent(index)]);
+			index = parent(index);
+		}
+
+		pq[index] = move(value);
+	}
+
+	// 루트의 빈 자리를 잎까지 내리기
+	/*
+	 * 마지막 요소는 대부분 잎 근처로 돌아가므로, 단계마다 그 값과 비교하지
+	 * 않고 우선순위가 가장 높은 자식을 끌어올리며 빈 자리를 잎까지 내린 뒤
+	 * 그곳에서 shift_up 합니다. 단계마다 비교가 한 번씩 줄어듭니다.
+	 * @return 빈 자리의 최종 위치
+	 */
+	size_t sink_hole(size_t index)
+	{
+		size_t size = pq.size();
+
+		while (true)
+		{
+			size_t first = first_child(index);
+			if (first >= size)
+			{
+				return index;
+			}
+
+			size_t best = best_child(first, min(first + D, size));
+			pq[index] = move(pq[best]);
+			index = best;
+		}
+	}
+
+	// [first, last) 범위의 형제 중 우선순위가 가장 높은 노드를 찾습니다.
+	size_t best_child(size_t first, size_t last)
+	{
+		size_t best = first;
+		for (size_t child = first + 1; child < last; child++)
+		{
+			best = compare(pq[best], pq[child]) ? child : best;
+		}
+		return best;
+	}
+
+	// value 를 index 위치에 놓는다고 보고, 자식 중 가장 우선순위가 높은
+	// 값보다 낮은 동안 빈 자리를 아래로 옮깁니다.
+	void shift_down(size_t index, T value)
+	{
+		size_t size = pq.size();
+
+		while (true)
+		{
+			size_t first = first_child(index);
+			if (first >= size)
+			{
+				break;
+			}
+
+			size_t best = best_child(first, min(first + D, size));
+
+			if (!compare(value, pq[best]))
+			{
+				break;
+			}
+
+			pq[index] = move(pq[best]);
+			index = best;
+		}
+
+		pq[index] = move(value);
+	}
+};
+
+// 비교용 이진 힙 (BinaryHeapPriorityQueue.cpp 와 같은 구조)
+/*
+ * 재귀적인 shift_down 과 단계마다 swap 하는 방식을 그대로 유지합니다.
+ */
+class BinaryHeap
+{
+	vector<int> pq;
+
+public:
+	void enqueue(int p)
+	{
+		pq.push_back(p);
+		shift_up(pq.size() - 1);
+	}
+
+	void dequeue()
+	{
+		pq[0] = pq.back();
+		pq.pop_back();
+		shift_down(0);
+	}
+
+	int peek()
+	{
+		return pq[0];
+	}
+
+	bool is_empty()
+	{
+		return pq.empty();
+	}
+
+private:
+	int parent(int index)
+	{
+		return (index - 1) / 2;
+	}
+
+	void shift_up(int index)
+	{
+		while (index > 0 && pq[parent(index)] < pq[index])
+		{
+			swap(pq[parent(index)], pq[index]);
+			index = parent(index);
+		}
+	}
+
+	void shift_down(int index)
+	{
+		int max_index = index;
+		int left = 2 * index + 1;
+		int right = 2 * index + 2;
+
+		if (left < (int)pq.size() && pq[left] > pq[max_index])
+		{
+			max_index = left;
+		}
+
+		if (right < (int)pq.size() && pq[right] > pq[max_index])
+		{
+			max_index = right;
+		}
+
+		if (index != max_index)
+		{
+			swap(pq[index], pq[max_index]);
+			shift_down(max_index);
+		}
+	}
+};
+
+// std::priority_queue 를 같은 인터페이스로 감쌉니다.
+class STLHeap
+{
+	priority_queue<int> pq;
+
+public:
+	void enqueue(int p)
+	{
+		pq.push(p);
+	}
+
+	void dequeue()
+	{
+		pq.pop();
+	}
+
+	int peek()
+	{
+		return pq.top();
+	}
+
+	bool is_empty()
+	{
+		return pq.empty();
+	}
+};
+
+// 모든 값을 삽입한 뒤 모두 꺼내며, 삽입/삭제 한 번의 평균 시간(나노초)을 측정합니다.
+template <typename Heap>
+void measure_push_pop(const vector<int>& values, double& push_ns, double& pop_ns, long long& checksum)
+{
+	Heap heap;
+
+	auto start = chrono::steady_clock::now();
+	for (int value : values)
+	{
+		heap.enqueue(value);
+	}
+	auto middle = chrono::steady_clock::now();
+	while (!heap.is_empty())
+	{
+		checksum += heap.peek();
+		heap.dequeue();
+	}
+	auto end = chrono::steady_clock::now();
+
+	push_ns = chrono::duration<double, nano>(middle - start).count() / values.size();
+	pop_ns = chrono::duration<double, nano>(end - middle).count() / values.size();
+}
+
+template <typename Heap>
+void report(const char* name, const vector<int>& values, long long& checksum)
+{
+	double push_ns, pop_ns;
+	measure_push_pop<Heap>(values, push_ns, pop_ns, checksum);
+	cout << "  " << name << " - push: " << push_ns << "ns, pop: " << pop_ns << "ns\n";
+}
+
+int main()
+{
+	// 범위로부터 O(n) 구성
+	vector<int> values = { 10, 40, 30, 5, 20, 60, 50 };
+	PriorityQueue<int> pq(values.begin(), values.end());
+
+	cout << "범위로부터 힙을 구성합니다: 10, 40, 30, 5, 20, 60, 50" << endl;
+	cout << "현재 큐의 가장 앞의 값: " << pq.peek() << endl;
+
+	vector<int> more = { 70, 1, 45 };
+	cout << "\n여러 값을 한 번에 추가합니다: 70, 1, 45" << endl;
+	pq.push_range(more.begin(), more.end());
+
+	cout << "큐에서 값들을 우선순위 순서대로 꺼냅니다: ";
+	while (!pq.is_empty())
+	{
+		cout << pq.peek() << " ";
+		pq.dequeue();
+	}
+	cout << endl;
+
+	cout << "\n비어있는 큐에서 peek() 호출 시도..." << endl;
+	try
+	{
+		cout << "현재 큐의 최상단 값: " << pq.peek() << endl;
+	}
+	catch (const exception& e)
+	{
+		cout << "(오류 발생) " << e.what() << endl;
+	}
+
+	// 최소 힙 (8-진)
+	PriorityQueue<int, 8, greater<int>> min_pq(values.begin(), values.end());
+	cout << "\n8-진 최소 힙의 가장 앞의 값: " << min_pq.peek() << endl;
+
+	// 벤치마크
+	/*
+	 * 크기별로 무작위 값을 모두 삽입한 뒤 모두 꺼냅니다.
+	 * 기본값은 1천만 개까지이며, 1억 개까지 측정하려면 MAX_N 을 늘립니다.
+	 * (힙마다 약 400MB 이상 사용)
+	 */
+	const size_t MAX_N = 10000000;
+	mt19937 rng(42);
+	long long checksum = 0;
+
+	for (size_t n = 1000; n <= MAX_N; n *= 10)
+	{
+		vector<int> input(n);
+		for (int& value : input)
+		{
+			value = static_cast<int>(rng());
+		}
+
+		cout << "\n[요소 " << n << "개: 요소당 평균 시간]\n";
+		report<BinaryHeap>("Binary heap        ", input, checksum);
+		report<STLHeap>("std::priority_queue", input, checksum);
+		report<PriorityQueue<int, 4>>("4-ary heap         ", input, checksum);
+		report<PriorityQueue<int, 8>>("8-ary heap         ", input, checksum);
+
+		// 하나씩 삽입하는 것과 범위로부터 구성하는 것의 비교
+		auto start = chrono::steady_clock::now();
+		PriorityQueue<int, 4> built(input.begin(), input.end());
+		chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+		checksum += built.peek();
+		cout << "  4-ary heapify      - " << elapsed.count() / n << "ns\n";
+	}
+
+	cout << "\n(checksum " << checksum << ")" << endl;
+
+	return 0;
+}
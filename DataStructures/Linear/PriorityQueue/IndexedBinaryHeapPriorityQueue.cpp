@@ -0,0 +1,421 @@
+/*
+ * 인덱스 이진 힙 기반 우선순위 큐 (Indexed Binary Heap)
+ *
+ * 일반 이진 힙은 요소가 shift_up/shift_down 으로 이동할 때마다 배열
+ * 인덱스가 바뀌므로, 바깥에서 특정 요소를 가리켜 우선순위를 바꾸거나
+ * 삭제할 수 없습니다.
+ *
+ * 인덱스 힙은 삽입 시 변하지 않는 핸들(handle)을 돌려주고, 핸들마다 현재
+ * 힙 배열에서의 위치를 기록한 위치 표(position map)를 유지합니다. 요소가
+ * 교환될 때마다 위치 표도 함께 갱신하므로, 핸들로 요소를 찾는 것은 O(1),
+ * 우선순위 변경(decrease_key/increase_key)과 임의 삭제(erase)는
+ * O(log n)에 처리됩니다.
+ *
+ * 비교 함수는 std::priority_queue 와 같은 규칙을 따릅니다.
+ * less<int>(기본값)는 값이 클수록, greater<int>는 값이 작을수록 우선순위가
+ * 높습니다. 다익스트라 알고리즘처럼 최소 비용을 먼저 꺼내야 한다면
+ * greater<int>를 사용합니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <climits>
+#include <cstdint>
+
+using namespace std;
+
+template <typename Compare = less<int>>
+class PriorityQueue
+{
+public:
+	// 삽입 시 발급되는 핸들 (상위 32비트: 세대, 하위 32비트: 노드 번호)
+	/*
+	 * 요소가 큐에 남아 있는 동안 변하지 않습니다. 제거된 요소의 노드는
+	 * 새로 삽입되는 요소에 재사용되지만, 그때마다 세대가 바뀌므로 이전
+	 * 핸들로는 새 요소에 접근할 수 없습니다.
+	 */
+	using Handle = uint64_t;
+
+	// 어떤 요소도 가리키지 않는 핸들
+	static constexpr Handle INVALID_HANDLE = UINT64_MAX;
+
+private:
+	struct Node
+	{
+		int value;
+		int priority;
+		int position;        // 힙 배열에서의 위치, 제거된 경우 -1
+		uint32_t generation; // 노드가 재사용될 때마다 증가
+	};
+
+	vector<int> heap;      // 힙 배열 (노드 번호를 저장)
+	vector<Node> nodes;    // 노드별 요소 정보 (위치 표 포함)
+	vector<int> freeNodes; // 재사용할 수 있는 노드 번호
+	Compare compare;
+
+public:
+	Handle enqueue(int value, int priority)
+	{
+		int index;
+		if (freeNodes.empty())
+		{
+			index = static_cast<int>(nodes.size());
+			nodes.push_back({ value, priority, -1, 0 });
+		}
+		else
+		{
+			index = freeNodes.back();
+			freeNodes.pop_back();
+			nodes[index].value = value;
+			nodes[index].priority = priority;
+		}
+
+		heap.push_back(index);
+		nodes[index].position = static_cast<int>(heap.size()) - 1;
+		shift_up(nodes[index].position);
+
+		return make_handle(index);
+	}
+
+	void dequeue()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue Underflow");
+		}
+
+		remove_at(0);
+	}
+
+	// 가장 우선순위가 높은 요소의 값
+	int peek()
+	{
+		return nodes[top()].value;
+	}
+
+	// 가장 우선순위가 높은 요소의 핸들
+	Handle peek_handle()
+	{
+		return make_handle(top());
+	}
+
+	bool is_empty()
+	{
+		return heap.empty();
+	}
+
+	int size()
+	{
+		return static_cast<int>(heap.size());
+	}
+
+	// 핸들이 가리키는 요소가 아직 큐에 있는지 확인합니다.
+	/*
+	 * 노드가 재사용되었다면 세대가 달라 false 를 반환합니다.
+	 */
+	bool contains(Handle handle)
+	{
+		uint32_t index = static_cast<uint32_t>(handle);
+		uint32_t generation = static_cast<uint32_t>(handle >> 32);
+
+		return index < nodes.size() && nodes[index].generation == generation &&
+			nodes[index].position != -1;
+	}
+
+	int value_of(Handle handle)
+	{
+		return nodes[checked(handle)].value;
+	}
+
+	int priority_of(Handle handle)
+	{
+		return nodes[checked(handle)].priority;
+	}
+
+	// 핸들이 가리키는 요소의 우선순위를 변경합니다.
+	/*
+	 * 비교 결과에 따라 위(shift_up) 또는 아래(shift_down)로 이동합니다.
+	 * 시간 복잡도: O(log n)
+	 */
+	void change_priority(Handle handle, int new_priority)
+	{
+		Node& node = nodes[checked(handle)];
+		int old_priority = node.priority;
+		node.priority = new_priority;
+
+		if (compare(old_priority, new_priority))
+		{
+			shift_up(node.position);
+		}
+		else
+		{
+			shift_down(node.position);
+		}
+	}
+
+	// 우선순위 값을 더 작은 값으로 변경합니다. (예: 다익스트라의 거리 갱신)
+	void decrease_key(Handle handle, int new_priority)
+	{
+		if (new_priority > priority_of(handle))
+		{
+			throw runtime_error("New priority is greater than current priority");
+		}
+		change_priority(handle, new_priority);
+	}
+
+	// 우선순위 값을 더 큰 값으로 변경합니다.
+	void increase_key(Handle handle, int new_priority)
+	{
+		if (new_priority < priority_of(handle))
+		{
+			throw runtime_error("New priority is less than current priority");
+		}
+		change_priority(handle, new_priority);
+	}
+
+	// 핸들이 가리키는 요소를 제거합니다.
+	/*
+	 * 마지막 요소를 제거할 위치로 옮긴 뒤, 그 요소의 우선순위에 따라
+	 * 위 또는 아래로 이동시킵니다.
+	 * 시간 복잡도: O(log n)
+	 */
+	void erase(Handle handle)
+	{
+		remove_at(nodes[checked(handle)].position);
+	}
+
+private:
+	Handle make_handle(int index)
+	{
+		return (static_cast<uint64_t>(nodes[index].generation) << 32) | static_cast<uint32_t>(index);
+	}
+
+	// 유효한 핸들이라면 노드 번호를 반환합니다.
+	int checked(Handle handle)
+	{
+		if (!contains(handle))
+		{
+			throw runtime_error("Invalid handle");
+		}
+		return static_cast<int>(static_cast<uint32_t>(handle));
+	}
+
+	// 가장 우선순위가 높은 요소의 노드 번호
+	int top()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue is empty");
+		}
+		return heap[0];
+	}
+
+	// 현재 노드의 부모 노드를 계산합니다.
+	int parent(int index)
+	{
+		return (index - 1) / 2;
+	}
+
+	// 현재 노드의 왼쪽 자식 노드를 계산합니다.
+	int left_child(int index)
+	{
+		return (2 * index) + 1;
+	}
+
+	// 현재 노드의 오른쪽 자식 노드를 계산합니다.
+	int right_child(int index)
+	{
+		return (2 * index) + 2;
+	}
+
+	// a 위치의 요소가 b 위치의 요소보다 우선순위가 높은지 비교합니다.
+	bool higher(int a, int b)
+	{
+		return compare(nodes[heap[b]].priority, nodes[heap[a]].priority);
+	}
+
+	// 두 위치의 요소를 교환하고 위치 표를 갱신합니다.
+	void swap_nodes(int a, int b)
+	{
+		swap(heap[a], heap[b]);
+		nodes[heap[a]].position = a;
+		nodes[heap[b]].position = b;
+	}
+
+	void remove_at(int index)
+	{
+		int removed = heap[index];
+		int last = static_cast<int>(heap.size()) - 1;
+
+		swap_nodes(index, last);
+		heap.pop_back();
+
+		nodes[removed].position = -1;
+		nodes[removed].generation++;
+		freeNodes.push_back(removed);
+
+		if (index < last)
+		{
+			shift_up(index);
+			shift_down(index);
+		}
+	}
+
+	// 부모보다 우선순위가 높은 동안 위로 이동합니다.
+	void shift_up(int index)
+	{
+		while (index > 0 && higher(index, parent(index)))
+		{
+			swap_nodes(index, parent(index));
+			index = parent(index);
+		}
+	}
+
+	// 자식보다 우선순위가 낮은 동안 아래로 이동합니다.
+	void shift_down(int index)
+	{
+		int size = static_cast<int>(heap.size());
+
+		while (true)
+		{
+			int best = index;
+			int left = left_child(index);
+			int right = right_child(index);
+
+			if (left < size && higher(left, best))
+			{
+				best = left;
+			}
+
+			if (right < size && higher(right, best))
+			{
+				best = right;
+			}
+
+			if (best == index)
+			{
+				break;
+			}
+
+			swap_nodes(index, best);
+			index = best;
+		}
+	}
+};
+
+/**
+ * 인덱스 힙을 사용한 다익스트라 최단 거리
+ * 정점마다 핸들을 하나씩 유지하고, 더 짧은 거리를 찾으면 새로 삽입하는
+ * 대신 decrease_key 로 갱신하므로 큐의 크기가 정점 수를 넘지 않습니다.
+ * @param graph 가중치 그래프 (인접 리스트)
+ * @param start 시작 노드
+ * @return 시작 노드에서 각 노드까지의 최단 거리
+ */
+vector<int> dijkstra(const vector<vector<pair<int, int>>>& graph, int start)
+{
+	vector<int> dist(graph.size(), INT_MAX);
+	using Queue = PriorityQueue<greater<int>>;
+	vector<Queue::Handle> handle(graph.size(), Queue::INVALID_HANDLE);
+	Queue pq;
+
+	dist[start] = 0;
+	handle[start] = pq.enqueue(start, 0);
+
+	while (!pq.is_empty())
+	{
+		int node = pq.peek();
+		pq.dequeue();
+
+		for (auto [neighbor, weight] : graph[node])
+		{
+			int new_dist = dist[node] + weight;
+			if (new_dist >= dist[neighbor])
+			{
+				continue;
+			}
+
+			dist[neighbor] = new_dist;
+			if (pq.contains(handle[neighbor]))
+			{
+				pq.decrease_key(handle[neighbor], new_dist);
+			}
+			else
+			{
+				handle[neighbor] = pq.enqueue(neighbor, new_dist);
+			}
+		}
+	}
+
+	return dist;
+}
+
+int main()
+{
+	PriorityQueue<> pq;
+
+	cout << "큐에 값을 추가합니다: A(10), B(20), C(30), D(40)" << endl;
+	auto a = pq.enqueue('A', 10);
+	auto b = pq.enqueue('B', 20);
+	auto c = pq.enqueue('C', 30);
+	pq.enqueue('D', 40);
+
+	cout << "현재 큐의 가장 앞의 값: " << (char)pq.peek() << endl;
+
+	cout << "\nA의 우선순위를 50으로 높입니다." << endl;
+	pq.increase_key(a, 50);
+	cout << "현재 큐의 가장 앞의 값: " << (char)pq.peek() << endl;
+
+	cout << "\nC를 큐에서 제거합니다." << endl;
+	pq.erase(c);
+
+	cout << "E(15)를 추가합니다. (C가 쓰던 노드를 재사용)" << endl;
+	auto e = pq.enqueue('E', 15);
+	cout << "C의 핸들이 유효한가: " << (pq.contains(c) ? "예" : "아니오") << endl;
+	cout << "E의 핸들이 유효한가: " << (pq.contains(e) ? "예" : "아니오") << endl;
+
+	cout << "B의 우선순위를 5로 낮춥니다." << endl;
+	pq.decrease_key(b, 5);
+
+	cout << "\n큐에서 값들을 우선순위 순서대로 꺼냅니다: ";
+	while (!pq.is_empty())
+	{
+		cout << (char)pq.peek() << "(" << pq.priority_of(pq.peek_handle()) << ") ";
+		pq.dequeue();
+	}
+	cout << endl;
+
+	cout << "\n제거된 핸들로 접근 시도..." << endl;
+	try
+	{
+		pq.priority_of(c);
+	}
+	catch (const exception& e)
+	{
+		cout << "(오류 발생) " << e.what() << endl;
+	}
+
+	// 가중치 그래프 (인접 리스트: {이웃 노드, 가중치})
+	vector<vector<pair<int, int>>> graph =
+	{
+		{{1, 1}, {2, 2}},          // 0
+		{{0, 3}, {3, 4}, {4, 5}},  // 1
+		{{0, 6}, {5, 7}, {6, 13}}, // 2
+		{{1, 9}},                  // 3
+		{{1, 10}},                 // 4
+		{{2, 11}, {6, 1}},         // 5
+		{{2, 12}}                  // 6
+	};
+
+	cout << "\n다익스트라 (시작 노드 0): ";
+	vector<int> dist = dijkstra(graph, 0);
+	for (size_t i = 0; i < dist.size(); i++)
+	{
+		cout << i << ":" << dist[i] << " ";
+	}
+	cout << endl;
+
+	return 0;
+}
@@ -0,0 +1,372 @@
+/*
+ * 최소-최대 힙 기반 양방향 우선순위 큐 (Min-Max Heap)
+ *
+ * 이진 힙은 한쪽 끝(최대 또는 최소)에만 O(1)로 접근할 수 있습니다.
+ * 최소-최대 힙은 완전 이진 트리의 짝수 단계(루트 = 0단계)는 최소 단계,
+ * 홀수 단계는 최대 단계로 정합니다.
+ * - 최소 단계의 노드는 자신의 모든 자손보다 작거나 같습니다.
+ * - 최대 단계의 노드는 자신의 모든 자손보다 크거나 같습니다.
+ *
+ * 따라서 최솟값은 루트에, 최댓값은 루트의 두 자식 중 하나에 있어
+ * peek_min 과 peek_max 는 O(1)입니다. 삽입과 양쪽 끝의 삭제는 같은 종류의
+ * 단계끼리(조부모/손자) 비교하며 재정렬하므로 O(log n)입니다.
+ *
+ * 용량을 정하면(bounded mode) 가득 찬 상태에서 삽입할 때 반대쪽 끝의 요소를
+ * 내보냅니다. 예를 들어 우선순위가 높은 요소를 남기려면 최솟값을 내보냅니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+
+using namespace std;
+
+template <typename T = int>
+class PriorityQueue
+{
+public:
+	// 가득 찼을 때 내보낼 쪽
+	enum class Evict
+	{
+		MIN, // 큰 값들을 남깁니다.
+		MAX  // 작은 값들을 남깁니다.
+	};
+
+private:
+	vector<T> heap;
+	size_t capacity; // 0 이면 용량 제한 없음
+	Evict evict;
+
+public:
+	PriorityQueue() : capacity(0), evict(Evict::MIN)
+	{
+	}
+
+	// 용량이 제한된 큐
+	PriorityQueue(size_t capacity, Evict evict) : capacity(capacity), evict(evict)
+	{
+		if (capacity == 0)
+		{
+			throw invalid_argument("Capacity must be positive");
+		}
+		heap.reserve(capacity);
+	}
+
+	// 삽입
+	/*
+	 * 용량이 가득 찼다면 반대쪽 끝의 값과 비교해, 새 값이 더 나을 때만 그
+	 * 값을 내보내고(evicted 에 저장) 삽입합니다. 새 값이 더 나쁘면 삽입하지
+	 * 않고 false 를 반환합니다.
+	 * 시간 복잡도: O(log n)
+	 */
+	bool enqueue(const T& value, T* evicted = nullptr)
+	{
+		if (capacity != 0 && heap.size() == capacity)
+		{
+			if (evict == Evict::MIN)
+			{
+				if (!(peek_min() < value))
+				{
+					return false;
+				}
+				if (evicted != nullptr)
+				{
+					*evicted = peek_min();
+				}
+				replace_at(0, value);
+			}
+			else
+			{
+				if (!(value < peek_max()))
+				{
+					return false;
+				}
+				if (evicted != nullptr)
+				{
+					*evicted = peek_max();
+				}
+				replace_at(max_index(), value);
+			}
+			return true;
+		}
+
+		heap.push_back(value);
+		push_up(heap.size() - 1);
+		return true;
+	}
+
+	const T& peek_min() const
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue is empty");
+		}
+		return heap[0];
+	}
+
+	const T& peek_max() const
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue is empty");
+		}
+		return heap[max_index()];
+	}
+
+	// 최솟값 삭제
+	/*
+	 * 시간 복잡도: O(log n)
+	 */
+	void pop_min()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue Underflow");
+		}
+		remove_at(0);
+	}
+
+	// 최댓값 삭제
+	/*
+	 * 시간 복잡도: O(log n)
+	 */
+	void pop_max()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue Underflow");
+		}
+		remove_at(max_index());
+	}
+
+	bool is_empty() const
+	{
+		return heap.empty();
+	}
+
+	size_t size() const
+	{
+		return heap.size();
+	}
+
+private:
+	// 최댓값은 루트의 두 자식 중 더 큰 쪽입니다. (요소가 하나면 루트)
+	size_t max_index() const
+	{
+		if (heap.size() == 1)
+		{
+			return 0;
+		}
+		if (heap.size() == 2 || heap[2] < heap[1])
+		{
+			return 1;
+		}
+		return 2;
+	}
+
+	// 인덱스가 최소 단계(짝수 단계)에 있는지 확인합니다.
+	static bool is_min_level(size_t index)
+	{
+		int level = 0;
+		for (size_t n = index + 1; n > 1; n >>= 1)
+		{
+			level++;
+		}
+		return level % 2 == 0;
+	}
+
+	static size_t parent(size_t index)
+	{
+		return (index - 1) / 2;
+	}
+
+	// 지정한 위치의 값을 내보내고 새 값을 삽입합니다.
+	/*
+	 * 새 값은 반대쪽 끝을 넘어설 수도 있으므로(예: 최댓값 자리에 넣는 값이
+	 * 최솟값보다 작을 때), 제자리에서 바꾸지 않고 삭제 후 삽입합니다.
+	 */
+	void replace_at(size_t index, const T& value)
+	{
+		remove_at(index);
+		heap.push_back(value);
+		push_up(heap.size() - 1);
+	}
+
+	// 지정한 위치를 마지막 요소로 채우고 아래로 재정렬합니다.
+	void remove_at(size_t index)
+	{
+		heap[index] = heap.back();
+		heap.pop_back();
+		if (index < heap.size())
+		{
+			push_down(index);
+		}
+	}
+
+	// 위로 재정렬
+	/*
+	 * 먼저 부모와 비교해 어느 종류의 단계에 속해야 하는지 정한 뒤, 같은
+	 * 종류의 단계인 조부모를 따라 올라갑니다.
+	 */
+	void push_up(size_t index)
+	{
+		if (index == 0)
+		{
+			return;
+		}
+
+		size_t p = parent(index);
+		if (is_min_level(index))
+		{
+			if (heap[p] < heap[index])
+			{
+				swap(heap[index], heap[p]);
+				push_up_along(p, true);
+			}
+			else
+			{
+				push_up_along(index, false);
+			}
+		}
+		else
+		{
+			if (heap[index] < heap[p])
+			{
+				swap(heap[index], heap[p]);
+				push_up_along(p, false);
+			}
+			else
+			{
+				push_up_along(index, true);
+			}
+		}
+	}
+
+	// 조부모를 따라 올라갑니다. (is_max: 최대 단계를 따라가는지 여부)
+	void push_up_along(size_t index, bool is_max)
+	{
+		while (index > 2)
+		{
+			size_t grandparent = parent(parent(index));
+			bool better = is_max ? heap[grandparent] < heap[index]
+				: heap[index] < heap[grandparent];
+			if (!better)
+			{
+				break;
+			}
+			swap(heap[index], heap[grandparent]);
+			index = grandparent;
+		}
+	}
+
+	// 아래로 재정렬
+	/*
+	 * 최소 단계라면 자식과 손자 중 가장 작은 값을, 최대 단계라면 가장 큰 값을
+	 * 찾습니다. 그 값이 손자라면 교환 후 손자의 부모(반대 종류의 단계)와도
+	 * 비교해 바로잡고, 손자 위치에서 계속 내려갑니다.
+	 */
+	void push_down(size_t index)
+	{
+		bool is_max = !is_min_level(index);
+		size_t size = heap.size();
+
+		while (true)
+		{
+			size_t first_child = 2 * index + 1;
+			if (first_child >= size)
+			{
+				return;
+			}
+
+			// 자식 2개와 손자 4개 중 가장 극단적인 값
+			size_t best = first_child;
+			size_t candidates[] = { first_child + 1, 2 * first_child + 1, 2 * first_child + 2,
+				2 * first_child + 3, 2 * first_child + 4 };
+			for (size_t candidate : candidates)
+			{
+				if (candidate < size && (is_max ? heap[best] < heap[candidate]
+					: heap[candidate] < heap[best]))
+				{
+					best = candidate;
+				}
+			}
+
+			bool better = is_max ? heap[index] < heap[best] : heap[best] < heap[index];
+			if (!better)
+			{
+				return;
+			}
+
+			swap(heap[index], heap[best]);
+			if (best <= first_child + 1)
+			{
+				// 자식과 교환했다면 그 아래는 이미 올바릅니다.
+				return;
+			}
+
+			size_t p = parent(best);
+			bool wrong = is_max ? heap[best] < heap[p] : heap[p] < heap[best];
+			if (wrong)
+			{
+				swap(heap[best], heap[p]);
+			}
+			index = best;
+		}
+	}
+};
+
+int main()
+{
+	PriorityQueue<int> pq;
+
+	cout << "큐에 값을 추가합니다: 30, 10, 50, 20, 40" << endl;
+	for (int value : { 30, 10, 50, 20, 40 })
+	{
+		pq.enqueue(value);
+	}
+
+	cout << "최솟값: " << pq.peek_min() << ", 최댓값: " << pq.peek_max() << endl;
+
+	cout << "\n최솟값과 최댓값을 하나씩 제거합니다." << endl;
+	pq.pop_min();
+	pq.pop_max();
+	cout << "최솟값: " << pq.peek_min() << ", 최댓값: " << pq.peek_max() << endl;
+
+	// 용량 제한: 큰 값 3개만 남깁니다.
+	PriorityQueue<int> bounded(3, PriorityQueue<int>::Evict::MIN);
+
+	cout << "\n용량 3 (최솟값을 내보냄)에 값을 추가합니다: 5, 8, 1, 9, 3, 7" << endl;
+	for (int value : { 5, 8, 1, 9, 3, 7 })
+	{
+		int evicted = -1;
+		if (!bounded.enqueue(value, &evicted))
+		{
+			cout << "  " << value << " 거절" << endl;
+		}
+		else if (evicted != -1)
+		{
+			cout << "  " << value << " 삽입, " << evicted << " 내보냄" << endl;
+		}
+	}
+
+	cout << "남은 값 (작은 것부터): ";
+	while (!bounded.is_empty())
+	{
+		cout << bounded.peek_min() << " ";
+		bounded.pop_min();
+	}
+	cout << endl;
+
+	cout << "\n비어있는 큐에서 peek_max() 호출 시도..." << endl;
+	try
+	{
+		cout << "최댓값: " << bounded.peek_max() << endl;
+	}
+	catch (const exception& e)
+	{
+		cout << "(오류 발생) " << e.what() << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,467 @@
+/*
+ * 멀티큐 기반 완화된 동시성 우선순위 큐 (MultiQueue)
+ *
+ * 하나의 힙을 전역 락으로 보호하면 모든 스레드가 같은 락을 기다리게 되어
+ * 스레드 수를 늘려도 처리량이 늘지 않습니다.
+ *
+ * 멀티큐는 스레드 수 P 의 c 배만큼 독립된 이진 최대 힙을 두고, 힙마다
+ * try-lock 을 둡니다.
+ * - 삽입(enqueue): 무작위로 고른 힙의 락을 잡아 삽입합니다. 락이 이미 잡혀
+ *   있으면 기다리지 않고 다른 힙을 고릅니다.
+ * - 삭제(dequeue): 무작위로 두 힙을 골라 맨 위 값을 비교하고, 더 큰 쪽에서
+ *   꺼냅니다(two-choice).
+ *
+ * 꺼낸 값이 항상 전체의 최댓값은 아니지만, 두 개 중 더 나은 쪽을 고르므로
+ * 순위 오차(rank error, 꺼낸 값보다 큰 값이 몇 개 남아 있는지)의 기댓값이
+ * 힙 개수에 비례하는 수준으로 제한됩니다. 정확한 순서 대신 거의 선형에 가까운
+ * 확장성을 얻는 구조입니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <cstdint>
+
+using namespace std;
+
+// 이진 최대 힙 (BinaryHeapPriorityQueue.cpp 와 같은 구조)
+/*
+ * 재정렬은 재귀 대신 반복문으로, swap 대신 빈 자리를 옮기는 방식으로 합니다.
+ */
+class BinaryHeap
+{
+	vector<int> pq;
+
+public:
+	void enqueue(int p)
+	{
+		pq.push_back(p);
+		shift_up(pq.size() - 1);
+	}
+
+	void dequeue()
+	{
+		int last = pq.back();
+		pq.pop_back();
+		if (!pq.empty())
+		{
+			shift_down(0, last);
+		}
+	}
+
+	int peek()
+	{
+		return pq[0];
+	}
+
+	bool is_empty()
+	{
+		return pq.empty();
+	}
+
+	size_t size()
+	{
+		return pq.size();
+	}
+
+private:
+	void shift_up(size_t index)
+	{
+		int value = pq[index];
+		while (index > 0 && pq[(index - 1) / 2] < value)
+		{
+			pq[index] = pq[(index - 1) / 2];
+			index = (index - 1) / 2;
+		}
+		pq[index] = value;
+	}
+
+	void shift_down(size_t index, int value)
+	{
+		size_t size = pq.size();
+		while (true)
+		{
+			size_t child = 2 * index + 1;
+			if (child >= size)
+			{
+				break;
+			}
+			if (child + 1 < size && pq[child] < pq[child + 1])
+			{
+				child++;
+			}
+			if (!(value < pq[child]))
+			{
+				break;
+			}
+			pq[index] = pq[child];
+			index = child;
+		}
+		pq[index] = value;
+	}
+};
+
+class PriorityQueue
+{
+	// 비어 있는 힙의 맨 위 값
+	static constexpr int EMPTY = INT_MIN;
+
+	// 내부 힙
+	/*
+	 * 서로 다른 힙의 락이 같은 캐시 라인을 공유하지 않도록 64바이트 단위로
+	 * 정렬합니다(false sharing 방지). top 은 락 없이 읽을 수 있도록 맨 위
+	 * 값을 따로 기록해 둔 것으로, 두 힙을 비교할 때 사용합니다.
+	 */
+	struct alignas(64) SubQueue
+	{
+		atomic<bool> locked{ false };
+		atomic<int> top{ EMPTY };
+		BinaryHeap heap;
+
+		bool try_lock()
+		{
+			return !locked.load(memory_order_relaxed) &&
+				!locked.exchange(true, memory_order_acquire);
+		}
+
+		void unlock()
+		{
+			top.store(heap.is_empty() ? EMPTY : heap.peek(), memory_order_relaxed);
+			locked.store(false, memory_order_release);
+		}
+	};
+
+	int queueCount;
+	vector<SubQueue> queues;
+
+public:
+	// threadCount 개의 스레드가 사용할 때 threadCount * c 개의 힙을 둡니다.
+	PriorityQueue(int threadCount, int c = 2)
+		: queueCount(max(2, threadCount * c)),
+		  queues(queueCount)
+	{
+	}
+
+	// 삽입
+	/*
+	 * 무작위 힙의 락을 잡을 때까지 다른 힙을 골라 다시 시도합니다.
+	 * INT_MIN 은 빈 힙을 나타내는 값이므로 우선순위로 사용할 수 없습니다.
+	 * 시간 복잡도: O(log n) (n: 힙 하나의 크기)
+	 */
+	void enqueue(int priority)
+	{
+		while (true)
+		{
+			SubQueue& queue = queues[random_index()];
+			if (queue.try_lock())
+			{
+				queue.heap.enqueue(priority);
+				queue.unlock();
+				return;
+			}
+		}
+	}
+
+	// 삭제
+	/*
+	 * 두 힙 중 맨 위 값이 더 큰 쪽에서 꺼내 priority 에 저장합니다.
+	 * 골라진 두 힙이 계속 비어 있으면 모든 힙을 확인하고, 모두 비어 있을
+	 * 때만 false 를 반환합니다. (다른 스레드가 동시에 삽입 중이라면 비어
+	 * 있다는 판단은 근사값입니다.)
+	 * 시간 복잡도: O(log n) (n: 힙 하나의 크기)
+	 */
+	bool dequeue(int& priority)
+	{
+		int emptyTries = 0;
+
+		while (true)
+		{
+			int a = random_index();
+			int b = random_index();
+			int topA = queues[a].top.load(memory_order_relaxed);
+			int topB = queues[b].top.load(memory_order_relaxed);
+
+			if (topA == EMPTY && topB == EMPTY)
+			{
+				if (++emptyTries >= 4)
+				{
+					if (is_empty())
+					{
+						return false;
+					}
+					emptyTries = 0;
+				}
+				continue;
+			}
+
+			SubQueue& queue = queues[topA >= topB ? a : b];
+			if (!queue.try_lock())
+			{
+				continue;
+			}
+
+			// 락을 잡는 사이 다른 스레드가 비웠을 수 있습니다.
+			if (queue.heap.is_empty())
+			{
+				queue.unlock();
+				continue;
+			}
+
+			priority = queue.heap.peek();
+			queue.heap.dequeue();
+			queue.unlock();
+			return true;
+		}
+	}
+
+	// 모든 힙이 비어 있는지 확인합니다. (동시 수정 중이라면 근사값)
+	bool is_empty()
+	{
+		for (SubQueue& queue : queues)
+		{
+			if (queue.top.load(memory_order_relaxed) != EMPTY)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	int queue_count()
+	{
+		return queueCount;
+	}
+
+private:
+	// 스레드마다 독립적인 xorshift 난수
+	int random_index()
+	{
+		thread_local uint32_t state =
+			static_cast<uint32_t>(hash<thread::id>()(this_thread::get_id())) | 1u;
+
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return static_cast<int>((static_cast<uint64_t>(state) * queueCount) >> 32);
+	}
+};
+
+// 비교용: 전역 mutex 로 보호하는 하나의 이진 힙
+class LockedBinaryHeap
+{
+	mutex lock;
+	BinaryHeap heap;
+
+public:
+	LockedBinaryHeap(int, int = 2)
+	{
+	}
+
+	void enqueue(int priority)
+	{
+		lock_guard<mutex> guard(lock);
+		heap.enqueue(priority);
+	}
+
+	bool dequeue(int& priority)
+	{
+		lock_guard<mutex> guard(lock);
+		if (heap.is_empty())
+		{
+			return false;
+		}
+		priority = heap.peek();
+		heap.dequeue();
+		return true;
+	}
+};
+
+// 처리량 측정
+/*
+ * 미리 prefill 개를 넣어 둔 뒤, 각 스레드가 삽입과 삭제를 번갈아
+ * opsPerThread 번 수행합니다.
+ * @return 초당 연산 수(백만 단위)
+ */
+template <typename Queue>
+double measure_throughput(int threadCount, int prefill, int opsPerThread)
+{
+	Queue pq(threadCount);
+	mt19937 rng(1);
+	for (int i = 0; i < prefill; i++)
+	{
+		pq.enqueue(static_cast<int>(rng() >> 1));
+	}
+
+	vector<thread> workers;
+	auto start = chrono::steady_clock::now();
+
+	for (int t = 0; t < threadCount; t++)
+	{
+		workers.emplace_back([&pq, t, opsPerThread]
+			{
+				mt19937 local(t + 1);
+				int priority;
+				for (int i = 0; i < opsPerThread; i++)
+				{
+					if (i & 1)
+					{
+						pq.dequeue(priority);
+					}
+					else
+					{
+						pq.enqueue(static_cast<int>(local() >> 1));
+					}
+				}
+			});
+	}
+
+	for (thread& worker : workers)
+	{
+		worker.join();
+	}
+
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+	return (double)threadCount * opsPerThread / elapsed.count() / 1e6;
+}
+
+// 순위 오차 측정
+/*
+ * 0..n-1 을 무작위 순서로 넣은 뒤 pops 번 꺼내며, 꺼낸 값보다 큰 값이 큐에
+ * 몇 개 남아 있었는지(순위 오차)를 펜윅 트리로 셉니다. 정확한 우선순위 큐라면
+ * 순위 오차는 항상 0입니다.
+ */
+void measure_rank_error(int threadCount, int c, int n, int pops)
+{
+	PriorityQueue pq(threadCount, c);
+
+	vector<int> values(n);
+	for (int i = 0; i < n; i++)
+	{
+		values[i] = i;
+	}
+	shuffle(values.begin(), values.end(), mt19937(7));
+
+	// tree[i]: 아직 큐에 남아 있는 값의 개수 (펜윅 트리)
+	vector<int> tree(n + 1, 0);
+	auto update = [&](int value, int delta)
+	{
+		for (int i = value + 1; i <= n; i += i & -i)
+		{
+			tree[i] += delta;
+		}
+	};
+	auto count_le = [&](int value)
+	{
+		int sum = 0;
+		for (int i = value + 1; i > 0; i -= i & -i)
+		{
+			sum += tree[i];
+		}
+		return sum;
+	};
+
+	for (int value : values)
+	{
+		pq.enqueue(value);
+		update(value, 1);
+	}
+
+	long long totalError = 0;
+	int maxError = 0;
+	int remaining = n;
+	for (int i = 0; i < pops; i++)
+	{
+		int value;
+		pq.dequeue(value);
+
+		int error = remaining - count_le(value);
+		totalError += error;
+		maxError = max(maxError, error);
+
+		update(value, -1);
+		remaining--;
+	}
+
+	cout << "  힙 " << pq.queue_count() << "개 (P=" << threadCount << ", c=" << c
+		<< ") - 평균 순위 오차: " << (double)totalError / pops
+		<< ", 최대: " << maxError << '\n';
+}
+
+int main()
+{
+	PriorityQueue pq(2);
+
+	cout << "큐에 값을 추가합니다: 10, 40, 30, 20" << endl;
+	pq.enqueue(10);
+	pq.enqueue(40);
+	pq.enqueue(30);
+	pq.enqueue(20);
+
+	cout << "큐에서 값들을 꺼냅니다 (순서는 근사적): ";
+	int priority;
+	while (pq.dequeue(priority))
+	{
+		cout << priority << " ";
+	}
+	cout << endl;
+	cout << "큐가 비어있습니까?: " << (pq.is_empty() ? "네" : "아니오") << endl;
+
+	// 여러 스레드가 동시에 삽입한 뒤 모두 꺼내 개수를 확인합니다.
+	PriorityQueue shared(4);
+	vector<thread> producers;
+	for (int t = 0; t < 4; t++)
+	{
+		producers.emplace_back([&shared, t]
+			{
+				for (int i = 0; i < 10000; i++)
+				{
+					shared.enqueue(t * 10000 + i);
+				}
+			});
+	}
+	for (thread& producer : producers)
+	{
+		producer.join();
+	}
+
+	int popped = 0;
+	while (shared.dequeue(priority))
+	{
+		popped++;
+	}
+	cout << "\n4개 스레드가 삽입한 값 중 꺼낸 개수: " << popped << endl;
+
+	// 처리량 벤치마크
+	int maxThreads = max(1u, thread::hardware_concurrency());
+
+	cout << "\n[처리량 벤치마크 (Mops/s), 삽입 50% / 삭제 50%]\n";
+	for (int threads = 1;; threads = min(threads * 2, maxThreads))
+	{
+		cout << "스레드 " << threads << "개: 전역 락 = "
+			<< measure_throughput<LockedBinaryHeap>(threads, 1 << 20, 1000000)
+			<< ", MultiQueue = "
+			<< measure_throughput<PriorityQueue>(threads, 1 << 20, 1000000) << '\n';
+
+		if (threads == maxThreads)
+		{
+			break;
+		}
+	}
+
+	// 순위 오차
+	cout << "\n[순위 오차: 요소 1000000개 중 100000개 꺼내기]\n";
+	for (int threads : { 1, 4, 16, 64 })
+	{
+		measure_rank_error(threads, 2, 1000000, 100000);
+	}
+	measure_rank_error(16, 4, 1000000, 100000);
+
+	return 0;
+}
@@ -0,0 +1,472 @@
+/*
+ * 페어링 힙 기반 우선순위 큐 (Pairing Heap)
+ *
+ * 배열 대신 노드와 포인터로 이루어진 힙 정렬 트리(heap-ordered tree)입니다.
+ * 각 노드는 첫 번째 자식과 다음 형제를 가리키며, 우선순위 값이 작을수록
+ * 우선순위가 높습니다(최소 힙).
+ *
+ * 두 힙의 병합(meld)은 루트끼리 비교해 우선순위가 낮은 쪽을 높은 쪽의 자식으로
+ * 붙이기만 하면 되므로 O(1)입니다. 삽입(enqueue)은 노드 하나짜리 힙과의 병합이고,
+ * 우선순위 감소(decrease_key)는 해당 서브트리를 잘라 루트와 병합합니다.
+ * 삭제(dequeue)는 루트의 자식들을 두 번에 나눠 짝지어 병합(two-pass pairing)하며
+ * 분할 상환 O(log n)입니다.
+ *
+ * 노드는 큰 블록 단위로 한꺼번에 할당하는 노드 풀(pool)에서 가져오며, 삭제된
+ * 노드는 풀의 빈 목록(free list)으로 돌아가 재사용됩니다. 병합 시에는 상대 힙의
+ * 풀 블록도 함께 넘겨받으므로 노드를 복사하거나 다시 할당하지 않습니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <stdexcept>
+
+using namespace std;
+
+struct Node
+{
+	int data;
+	int priority;
+	Node* child;   // 첫 번째 자식
+	Node* sibling; // 다음 형제
+	Node* prev;    // 첫 번째 자식이면 부모, 아니면 이전 형제
+};
+
+// 노드 풀
+/*
+ * BLOCK_SIZE 개의 노드를 한 번에 할당해 앞에서부터 나눠 주고, 반환된 노드는
+ * sibling 포인터로 이어진 빈 목록에 보관합니다. 블록은 풀이 소멸될 때 한꺼번에
+ * 해제됩니다.
+ */
+class NodePool
+{
+	static constexpr size_t BLOCK_SIZE = 4096;
+
+	vector<unique_ptr<Node[]>> blocks;
+	Node* cursor = nullptr;    // 현재 블록에서 아직 나눠 주지 않은 첫 노드
+	Node* cursorEnd = nullptr;
+	Node* freeHead = nullptr;  // 반환된 노드 목록
+	Node* freeTail = nullptr;
+
+public:
+	Node* allocate()
+	{
+		if (freeHead != nullptr)
+		{
+			Node* node = freeHead;
+			freeHead = freeHead->sibling;
+			if (freeHead == nullptr)
+			{
+				freeTail = nullptr;
+			}
+			return node;
+		}
+
+		if (cursor == cursorEnd)
+		{
+			blocks.emplace_back(new Node[BLOCK_SIZE]);
+			cursor = blocks.back().get();
+			cursorEnd = cursor + BLOCK_SIZE;
+		}
+		return cursor++;
+	}
+
+	void release(Node* node)
+	{
+		node->sibling = nullptr;
+		if (freeTail == nullptr)
+		{
+			freeHead = node;
+		}
+		else
+		{
+			freeTail->sibling = node;
+		}
+		freeTail = node;
+	}
+
+	// 다른 풀의 블록과 빈 목록을 넘겨받습니다.
+	/*
+	 * 시간 복잡도: O(블록 수)
+	 */
+	void absorb(NodePool& other)
+	{
+		for (auto& block : other.blocks)
+		{
+			blocks.push_back(move(block));
+		}
+		other.blocks.clear();
+
+		if (other.freeHead != nullptr)
+		{
+			if (freeTail == nullptr)
+			{
+				freeHead = other.freeHead;
+			}
+			else
+			{
+				freeTail->sibling = other.freeHead;
+			}
+			freeTail = other.freeTail;
+		}
+
+		// 나눠 주지 않은 공간이 더 큰 쪽을 계속 사용합니다.
+		if (other.cursorEnd - other.cursor > cursorEnd - cursor)
+		{
+			cursor = other.cursor;
+			cursorEnd = other.cursorEnd;
+		}
+
+		other.cursor = other.cursorEnd = nullptr;
+		other.freeHead = other.freeTail = nullptr;
+	}
+};
+
+class PriorityQueue
+{
+	Node* root;
+	size_t count;
+	NodePool pool;
+	vector<Node*> pairs; // dequeue 에서 재사용하는 임시 배열
+
+public:
+	// 노드를 가리키는 핸들 (요소가 큐에 있는 동안 유효)
+	using Handle = Node*;
+
+	PriorityQueue() : root(nullptr), count(0)
+	{
+	}
+
+	PriorityQueue(const PriorityQueue&) = delete;
+	PriorityQueue& operator=(const PriorityQueue&) = delete;
+
+	// 삽입
+	/*
+	 * 노드 하나짜리 힙을 루트와 병합합니다.
+	 * 시간 복잡도: O(1)
+	 */
+	Handle enqueue(int data, int priority)
+	{
+		Node* node = pool.allocate();
+		*node = { data, priority, nullptr, nullptr, nullptr };
+
+		root = link(root, node);
+		count++;
+		return node;
+	}
+
+	// 삭제
+	/*
+	 * 루트를 제거하고 자식들을 두 번에 나눠 병합합니다.
+	 * 시간 복잡도: 분할 상환 O(log n)
+	 */
+	void dequeue()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue Underflow");
+		}
+
+		Node* old_root = root;
+		root = merge_children(root->child);
+		pool.release(old_root);
+		count--;
+	}
+
+	int peek()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue is empty");
+		}
+		return root->data;
+	}
+
+	int peek_priority()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue is empty");
+		}
+		return root->priority;
+	}
+
+	bool is_empty()
+	{
+		return root == nullptr;
+	}
+
+	size_t size()
+	{
+		return count;
+	}
+
+	// 우선순위 감소
+	/*
+	 * 핸들이 가리키는 노드의 우선순위 값을 줄이고, 루트가 아니라면 서브트리를
+	 * 부모에게서 잘라내 루트와 병합합니다.
+	 * 시간 복잡도: O(1) (분할 상환 분석에서는 O(log n) 이하)
+	 */
+	void decrease_key(Handle node, int new_priority)
+	{
+		if (new_priority > node->priority)
+		{
+			throw runtime_error("New priority is greater than current priority");
+		}
+
+		node->priority = new_priority;
+		if (node == root)
+		{
+			return;
+		}
+
+		detach(node);
+		root = link(root, node);
+	}
+
+	// 병합
+	/*
+	 * other 의 모든 요소를 이 큐로 옮기고 other 는 빈 큐가 됩니다. 노드를
+	 * 복사하지 않으며, other 에서 받은 핸들도 계속 이 큐에서 유효합니다.
+	 * 시간 복잡도: O(1) (노드 풀 블록을 넘겨받는 비용 제외)
+	 */
+	void meld(PriorityQueue& other)
+	{
+		if (&other == this)
+		{
+			return;
+		}
+
+		root = link(root, other.root);
+		count += other.count;
+		pool.absorb(other.pool);
+
+		other.root = nullptr;
+		other.count = 0;
+	}
+
+private:
+	// 두 힙 병합
+	/*
+	 * 우선순위가 낮은 루트를 높은 루트의 첫 번째 자식으로 붙입니다.
+	 * 두 인자는 모두 형제가 없는 루트여야 합니다.
+	 */
+	static Node* link(Node* a, Node* b)
+	{
+		if (a == nullptr)
+		{
+			return b;
+		}
+		if (b == nullptr)
+		{
+			return a;
+		}
+
+		if (b->priority < a->priority)
+		{
+			swap(a, b);
+		}
+
+		b->prev = a;
+		b->sibling = a->child;
+		if (a->child != nullptr)
+		{
+			a->child->prev = b;
+		}
+		a->child = b;
+		a->prev = nullptr;
+		a->sibling = nullptr;
+		return a;
+	}
+
+	// 노드를 부모 또는 형제 목록에서 잘라냅니다.
+	static void detach(Node* node)
+	{
+		if (node->prev->child == node)
+		{
+			node->prev->child = node->sibling;
+		}
+		else
+		{
+			node->prev->sibling = node->sibling;
+		}
+
+		if (node->sibling != nullptr)
+		{
+			node->sibling->prev = node->prev;
+		}
+
+		node->prev = nullptr;
+		node->sibling = nullptr;
+	}
+
+	// 두 번에 나눈 병합 (two-pass pairing)
+	/*
+	 * 1) 왼쪽부터 두 개씩 짝지어 병합합니다.
+	 * 2) 오른쪽 끝부터 앞으로 오며 하나로 병합합니다.
+	 * 자식이 많아도 재귀 없이 처리합니다.
+	 */
+	Node* merge_children(Node* first)
+	{
+		pairs.clear();
+
+		while (first != nullptr)
+		{
+			Node* a = first;
+			Node* b = a->sibling;
+			first = (b != nullptr) ? b->sibling : nullptr;
+
+			a->sibling = a->prev = nullptr;
+			if (b != nullptr)
+			{
+				b->sibling = b->prev = nullptr;
+			}
+			pairs.push_back(link(a, b));
+		}
+
+		Node* result = nullptr;
+		for (size_t i = pairs.size(); i-- > 0;)
+		{
+			result = link(pairs[i], result);
+		}
+		return result;
+	}
+};
+
+int main()
+{
+	PriorityQueue pq;
+
+	cout << "큐에 값을 추가합니다: A(40), B(30), C(20), D(10)" << endl;
+	auto a = pq.enqueue('A', 40);
+	pq.enqueue('B', 30);
+	pq.enqueue('C', 20);
+	pq.enqueue('D', 10);
+
+	cout << "현재 큐의 가장 앞의 값: " << (char)pq.peek() << endl;
+
+	cout << "\nA의 우선순위를 5로 낮춥니다." << endl;
+	pq.decrease_key(a, 5);
+	cout << "현재 큐의 가장 앞의 값: " << (char)pq.peek() << endl;
+
+	PriorityQueue other;
+	other.enqueue('E', 15);
+	other.enqueue('F', 1);
+
+	cout << "\n다른 큐(E(15), F(1))를 병합합니다." << endl;
+	pq.meld(other);
+	cout << "병합된 큐의 크기: " << pq.size() << ", 다른 큐가 비어있습니까?: "
+		<< (other.is_empty() ? "네" : "아니오") << endl;
+
+	cout << "\n큐에서 값들을 우선순위 순서대로 꺼냅니다: ";
+	while (!pq.is_empty())
+	{
+		cout << (char)pq.peek() << "(" << pq.peek_priority() << ") ";
+		pq.dequeue();
+	}
+	cout << endl;
+
+	cout << "\n비어있는 큐에서 peek() 호출 시도..." << endl;
+	try
+	{
+		cout << "현재 큐의 최상단 값: " << pq.peek() << endl;
+	}
+	catch (const exception& e)
+	{
+		cout << "(오류 발생) " << e.what() << endl;
+	}
+
+	// 벤치마크
+	/*
+	 * 스레드별 큐 THREADS 개에 요소를 나눠 넣은 뒤 하나의 큐로 합칩니다.
+	 * std::priority_queue 는 모든 요소를 다시 넣어야 하지만, 페어링 힙은
+	 * 루트 병합과 노드 풀 블록 이동만으로 끝납니다.
+	 */
+	const int THREADS = 8;
+	const int PER_THREAD = 1000000;
+	mt19937 rng(42);
+
+	vector<vector<int>> inputs(THREADS, vector<int>(PER_THREAD));
+	for (auto& input : inputs)
+	{
+		for (int& value : input)
+		{
+			value = static_cast<int>(rng() >> 1);
+		}
+	}
+
+	cout << "\n[큐 " << THREADS << "개(각 " << PER_THREAD << "개)를 하나로 병합]\n";
+
+	{
+		vector<priority_queue<int, vector<int>, greater<int>>> locals(THREADS);
+		auto start = chrono::steady_clock::now();
+		for (int t = 0; t < THREADS; t++)
+		{
+			for (int value : inputs[t])
+			{
+				locals[t].push(value);
+			}
+		}
+		auto middle = chrono::steady_clock::now();
+
+		priority_queue<int, vector<int>, greater<int>> global;
+		for (auto& local : locals)
+		{
+			while (!local.empty())
+			{
+				global.push(local.top());
+				local.pop();
+			}
+		}
+		auto end = chrono::steady_clock::now();
+
+		cout << "  std::priority_queue - 삽입: "
+			<< chrono::duration_cast<chrono::milliseconds>(middle - start).count() << "ms, 병합: "
+			<< chrono::duration_cast<chrono::milliseconds>(end - middle).count() << "ms (top "
+			<< global.top() << ")\n";
+	}
+
+	{
+		vector<PriorityQueue> locals(THREADS);
+		auto start = chrono::steady_clock::now();
+		for (int t = 0; t < THREADS; t++)
+		{
+			for (int value : inputs[t])
+			{
+				locals[t].enqueue(value, value);
+			}
+		}
+		auto middle = chrono::steady_clock::now();
+
+		PriorityQueue global;
+		for (auto& local : locals)
+		{
+			global.meld(local);
+		}
+		auto end = chrono::steady_clock::now();
+
+		cout << "  Pairing heap        - 삽입: "
+			<< chrono::duration_cast<chrono::milliseconds>(middle - start).count() << "ms, 병합: "
+			<< chrono::duration_cast<chrono::microseconds>(end - middle).count() << "us (top "
+			<< global.peek_priority() << ")\n";
+
+		// 병합 후 꺼내기
+		start = chrono::steady_clock::now();
+		long long checksum = 0;
+		for (int i = 0; i < PER_THREAD; i++)
+		{
+			checksum += global.peek_priority();
+			global.dequeue();
+		}
+		end = chrono::steady_clock::now();
+		cout << "  Pairing heap        - 병합 후 " << PER_THREAD << "개 꺼내기: "
+			<< chrono::duration_cast<chrono::milliseconds>(end - start).count() << "ms (checksum "
+			<< checksum << ")\n";
+	}
+
+	return 0;
+}
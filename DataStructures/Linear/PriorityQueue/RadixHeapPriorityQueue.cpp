@@ -0,0 +1,279 @@
+/*
+ * 기수 힙 기반 우선순위 큐 (Radix Heap)
+ *
+ * 다익스트라나 균일 비용 탐색처럼 꺼내는 키(우선순위)가 감소하지 않는
+ * (monotone) 경우에만 사용할 수 있는 정수 키 우선순위 큐입니다. 가장 작은
+ * 키가 가장 우선순위가 높습니다.
+ *
+ * 마지막으로 꺼낸 키(last)를 기준으로, 키 k 는 (k XOR last)의 최상위 비트
+ * 위치에 해당하는 버킷에 들어갑니다. 0번 버킷에는 last 와 같은 키만 있고,
+ * i번 버킷의 키는 모두 i-1번 버킷의 키보다 큽니다. 0번 버킷이 비면 비어있지
+ * 않은 가장 낮은 버킷에서 최소 키를 새 last 로 정하고, 그 버킷의 키들을 더
+ * 낮은 버킷으로 재분배합니다.
+ *
+ * 키 하나는 버킷 번호가 줄어드는 방향으로만 이동하므로, 키의 비트 수를 B 라
+ * 할 때 삽입(enqueue)은 O(1), 삭제(dequeue)는 분할 상환 O(B) 입니다.
+ * 비교 기반 힙과 달리 요소 수 n 에 의존하지 않습니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+template <typename Key = uint32_t, typename Data = int>
+class PriorityQueue
+{
+	static_assert(is_unsigned<Key>::value && sizeof(Key) <= 8, "Key must be a 32/64-bit unsigned integer");
+
+	static constexpr int BUCKET_COUNT = numeric_limits<Key>::digits + 1;
+
+	vector<pair<Key, Data>> buckets[BUCKET_COUNT];
+	Key last;     // 마지막으로 꺼낸 키
+	size_t count;
+
+	// peek 이 찾아 둔 최소 키의 위치 (0번 버킷이 비어 있을 때만 사용, 없으면 -1)
+	int minBucket;
+	size_t minIndex;
+
+public:
+	PriorityQueue() : last(0), count(0), minBucket(-1), minIndex(0)
+	{
+	}
+
+	// 삽입
+	/*
+	 * 마지막으로 꺼낸 키보다 작은 키는 넣을 수 없습니다.
+	 * 시간 복잡도: O(1)
+	 */
+	void enqueue(Data data, Key priority)
+	{
+		if (priority < last)
+		{
+			throw runtime_error("Priority is smaller than the last dequeued priority");
+		}
+
+		int index = bucket_index(priority);
+		buckets[index].emplace_back(priority, data);
+		count++;
+
+		if (index <= minBucket)
+		{
+			minBucket = -1;
+		}
+	}
+
+	// 삭제
+	/*
+	 * 시간 복잡도: 분할 상환 O(B) (B: 키의 비트 수)
+	 */
+	void dequeue()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue Underflow");
+		}
+
+		pull();
+		buckets[0].pop_back();
+		count--;
+	}
+
+	// 가장 우선순위가 높은(키가 가장 작은) 요소의 데이터
+	/*
+	 * 재분배는 dequeue 에서만 일어나므로, peek 뒤에도 마지막으로 꺼낸 키
+	 * 이상이면 어떤 키든 삽입할 수 있습니다.
+	 */
+	Data peek()
+	{
+		return front().second;
+	}
+
+	// 가장 작은 키
+	Key peek_priority()
+	{
+		return front().first;
+	}
+
+	bool is_empty() const
+	{
+		return count == 0;
+	}
+
+	size_t size() const
+	{
+		return count;
+	}
+
+	void clear()
+	{
+		for (auto& bucket : buckets)
+		{
+			bucket.clear();
+		}
+		last = 0;
+		count = 0;
+		minBucket = -1;
+		minIndex = 0;
+	}
+
+private:
+	const pair<Key, Data>& front()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue is empty");
+		}
+
+		if (!buckets[0].empty())
+		{
+			return buckets[0].back();
+		}
+
+		find_min();
+		return buckets[minBucket][minIndex];
+	}
+
+	// last 와 처음으로 달라지는 비트의 위치 + 1 (같으면 0)
+	int bucket_index(Key key) const
+	{
+		return bit_width(static_cast<uint64_t>(key ^ last));
+	}
+
+	static int bit_width(uint64_t x)
+	{
+		if (x == 0)
+		{
+			return 0;
+		}
+#if defined(__GNUC__) || defined(__clang__)
+		return 64 - __builtin_clzll(x);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse64(&index, x);
+		return static_cast<int>(index) + 1;
+#else
+		int width = 0;
+		while (x)
+		{
+			x >>= 1;
+			width++;
+		}
+		return width;
+#endif
+	}
+
+	// 비어있지 않은 가장 낮은 버킷에서 최소 키의 위치를 찾습니다.
+	void find_min()
+	{
+		if (minBucket != -1)
+		{
+			return;
+		}
+
+		int i = 1;
+		while (buckets[i].empty())
+		{
+			i++;
+		}
+
+		minBucket = i;
+		minIndex = 0;
+		for (size_t j = 1; j < buckets[i].size(); j++)
+		{
+			if (buckets[i][j].first < buckets[i][minIndex].first)
+			{
+				minIndex = j;
+			}
+		}
+	}
+
+	// 0번 버킷 채우기
+	/*
+	 * 0번 버킷이 비어 있다면, 비어있지 않은 가장 낮은 버킷의 최소 키를 새
+	 * last 로 정하고 그 버킷의 요소들을 다시 분배합니다. 최소 키는 0번 버킷으로
+	 * 가고, 나머지도 모두 더 낮은 번호의 버킷으로 이동합니다.
+	 */
+	void pull()
+	{
+		if (!buckets[0].empty())
+		{
+			return;
+		}
+
+		find_min();
+		int i = minBucket;
+		last = buckets[i][minIndex].first;
+		minBucket = -1;
+
+		// peek 이 돌려준 요소가 0번 버킷의 맨 뒤에 오도록 마지막에 옮깁니다.
+		swap(buckets[i][minIndex], buckets[i].back());
+
+		for (auto& item : buckets[i])
+		{
+			buckets[bucket_index(item.first)].push_back(move(item));
+		}
+		buckets[i].clear();
+	}
+};
+
+int main()
+{
+	PriorityQueue<> pq;
+
+	cout << "큐에 값을 추가합니다: A(5), B(3), C(8), D(3)" << endl;
+	pq.enqueue('A', 5);
+	pq.enqueue('B', 3);
+	pq.enqueue('C', 8);
+	pq.enqueue('D', 3);
+
+	cout << "현재 큐의 가장 앞의 값: " << (char)pq.peek() << "(" << pq.peek_priority() << ")" << endl;
+
+	cout << "\n하나를 꺼낸 뒤, 그보다 큰 키를 추가합니다: E(4), F(100)" << endl;
+	pq.dequeue();
+	pq.enqueue('E', 4);
+	pq.enqueue('F', 100);
+
+	cout << "큐에서 값들을 우선순위 순서대로 꺼냅니다: ";
+	while (!pq.is_empty())
+	{
+		cout << (char)pq.peek() << "(" << pq.peek_priority() << ") ";
+		pq.dequeue();
+	}
+	cout << endl;
+
+	cout << "\n마지막으로 꺼낸 키(100)보다 작은 키 추가 시도..." << endl;
+	try
+	{
+		pq.enqueue('G', 1);
+	}
+	catch (const exception& e)
+	{
+		cout << "(오류 발생) " << e.what() << endl;
+	}
+
+	cout << "\n큐를 비운 뒤 다시 추가합니다: H(5) 확인 후 비우고 I(100)" << endl;
+	pq.clear();
+	pq.enqueue('H', 5);
+	pq.peek();
+	pq.clear();
+	pq.enqueue('I', 100);
+	cout << "현재 큐의 가장 앞의 값: " << (char)pq.peek() << "(" << pq.peek_priority() << ")" << endl;
+
+	// 64비트 키
+	PriorityQueue<uint64_t, int> wide;
+	wide.enqueue(1, 1ull << 40);
+	wide.enqueue(2, 7);
+	cout << "\n64비트 키 큐의 가장 앞의 값: " << wide.peek() << "(" << wide.peek_priority() << ")" << endl;
+
+	return 0;
+}
@@ -0,0 +1,376 @@
+/*
+ * 스킵 리스트 기반 우선순위 큐 (Skip List)
+ *
+ * 연결 리스트 기반 우선순위 큐는 삽입할 위치를 찾기 위해 목록을 처음부터
+ * 따라가야 하므로 삽입(enqueue)이 O(n)입니다.
+ *
+ * 스킵 리스트는 정렬된 연결 리스트 위에 여러 단계의 "고속 차선"을 둡니다.
+ * 각 노드는 무작위로 정한 높이(level)만큼의 다음 노드 포인터를 가지며, 높은
+ * 단계일수록 노드가 드물어 멀리 건너뜁니다. 위 단계부터 내려오며 삽입 위치를
+ * 찾으므로 삽입은 기대 O(log n)입니다.
+ *
+ * 우선순위 값이 가장 작은 요소가 항상 맨 앞에 있으므로 탐색(peek)은 O(1)이고,
+ * 삭제(dequeue)는 맨 앞 노드를 각 단계에서 떼어내기만 하면 되므로 기대
+ * O(1)입니다. 우선순위가 같은 요소들은 먼저 들어온 순서대로 나갑니다.
+ *
+ * 노드는 높이에 따라 크기가 다르므로, 큰 메모리 블록(arena)에서 잘라 쓰고
+ * 삭제된 노드는 높이별 빈 목록에 보관했다가 재사용합니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <new>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace std;
+
+struct Node
+{
+	int data;
+	int priority;
+	int level;
+	Node** next; // level 개의 다음 노드 포인터 (노드 바로 뒤에 이어서 할당)
+};
+
+// 노드 아레나
+/*
+ * BLOCK_BYTES 크기의 블록에서 노드와 포인터 배열을 연속으로 잘라 줍니다.
+ * 반환된 노드는 높이별 빈 목록(next[0] 으로 연결)에 넣어 같은 높이의 노드를
+ * 만들 때 재사용하며, 블록은 아레나가 소멸될 때 한꺼번에 해제됩니다.
+ */
+class NodeArena
+{
+public:
+	static constexpr int MAX_LEVEL = 32;
+
+private:
+	static constexpr size_t BLOCK_BYTES = 64 * 1024;
+
+	vector<unique_ptr<char[]>> blocks;
+	char* cursor = nullptr;
+	char* cursorEnd = nullptr;
+	Node* freeLists[MAX_LEVEL + 1] = {};
+
+public:
+	Node* allocate(int level)
+	{
+		Node* node = freeLists[level];
+		if (node != nullptr)
+		{
+			freeLists[level] = node->next[0];
+			return node;
+		}
+
+		size_t bytes = sizeof(Node) + level * sizeof(Node*);
+		if (cursor == nullptr || static_cast<size_t>(cursorEnd - cursor) < bytes)
+		{
+			blocks.emplace_back(new char[BLOCK_BYTES]);
+			cursor = blocks.back().get();
+			cursorEnd = cursor + BLOCK_BYTES;
+		}
+
+		node = new (cursor) Node{ 0, 0, level, reinterpret_cast<Node**>(cursor + sizeof(Node)) };
+		cursor += bytes;
+		return node;
+	}
+
+	void release(Node* node)
+	{
+		node->next[0] = freeLists[node->level];
+		freeLists[node->level] = node;
+	}
+};
+
+class PriorityQueue
+{
+	static constexpr int MAX_LEVEL = NodeArena::MAX_LEVEL;
+
+	NodeArena arena;
+	Node* head;   // 모든 단계의 시작점 (요소를 담지 않음)
+	int level;    // 현재 사용 중인 가장 높은 단계
+	size_t count;
+	uint32_t randomState;
+
+public:
+	PriorityQueue() : level(1), count(0), randomState(2463534242u)
+	{
+		head = arena.allocate(MAX_LEVEL);
+		for (int i = 0; i < MAX_LEVEL; i++)
+		{
+			head->next[i] = nullptr;
+		}
+	}
+
+	PriorityQueue(const PriorityQueue&) = delete;
+	PriorityQueue& operator=(const PriorityQueue&) = delete;
+
+	// 삽입
+	/*
+	 * 가장 높은 단계부터 내려오며, 각 단계에서 새 노드가 들어갈 자리 바로
+	 * 앞 노드(update)를 기록한 뒤 그 사이에 연결합니다.
+	 * 우선순위가 같은 노드들 뒤에 넣어 먼저 들어온 요소가 먼저 나가도록 합니다.
+	 * 시간 복잡도: 기대 O(log n)
+	 */
+	void enqueue(int data, int priority)
+	{
+		Node* update[MAX_LEVEL];
+		Node* current = head;
+
+		for (int i = level - 1; i >= 0; i--)
+		{
+			while (current->next[i] != nullptr && current->next[i]->priority <= priority)
+			{
+				current = current->next[i];
+			}
+			update[i] = current;
+		}
+
+		int new_level = random_level();
+		if (new_level > level)
+		{
+			for (int i = level; i < new_level; i++)
+			{
+				update[i] = head;
+			}
+			level = new_level;
+		}
+
+		Node* node = arena.allocate(new_level);
+		node->data = data;
+		node->priority = priority;
+		for (int i = 0; i < new_level; i++)
+		{
+			node->next[i] = update[i]->next[i];
+			update[i]->next[i] = node;
+		}
+
+		count++;
+	}
+
+	// 삭제
+	/*
+	 * 맨 앞 노드는 자신이 속한 모든 단계에서도 맨 앞이므로, head 의 포인터만
+	 * 바꾸면 됩니다.
+	 * 시간 복잡도: 기대 O(1)
+	 */
+	void dequeue()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue Underflow");
+		}
+
+		Node* front = head->next[0];
+		for (int i = 0; i < front->level; i++)
+		{
+			head->next[i] = front->next[i];
+		}
+
+		while (level > 1 && head->next[level - 1] == nullptr)
+		{
+			level--;
+		}
+
+		arena.release(front);
+		count--;
+	}
+
+	int peek()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue is empty");
+		}
+		return head->next[0]->data;
+	}
+
+	int peek_priority()
+	{
+		if (is_empty())
+		{
+			throw runtime_error("Queue is empty");
+		}
+		return head->next[0]->priority;
+	}
+
+	bool is_empty()
+	{
+		return head->next[0] == nullptr;
+	}
+
+	size_t size()
+	{
+		return count;
+	}
+
+private:
+	// 무작위 높이
+	/*
+	 * 다음 단계로 올라갈 확률을 1/4로 두어 노드당 평균 포인터 수를 4/3개로
+	 * 줄입니다. 난수의 하위 비트에서 연속된 0 비트 두 개마다 한 단계씩 올라갑니다.
+	 */
+	int random_level()
+	{
+		randomState ^= randomState << 13;
+		randomState ^= randomState >> 17;
+		randomState ^= randomState << 5;
+
+		uint32_t bits = randomState;
+		int new_level = 1;
+		while ((bits & 3) == 0 && new_level < MAX_LEVEL)
+		{
+			bits >>= 2;
+			new_level++;
+		}
+		return new_level;
+	}
+};
+
+// 비교용 연결 리스트 우선순위 큐 (LinkedListPriorityQueue.cpp 와 같은 구조)
+class LinkedListQueue
+{
+	struct ListNode
+	{
+		int data;
+		int priority;
+		ListNode* next;
+	};
+
+	ListNode* front = nullptr;
+
+public:
+	~LinkedListQueue()
+	{
+		while (!is_empty())
+		{
+			dequeue();
+		}
+	}
+
+	void enqueue(int data, int priority)
+	{
+		ListNode* new_node = new ListNode{ data, priority, nullptr };
+
+		if (is_empty() || priority < front->priority)
+		{
+			new_node->next = front;
+			front = new_node;
+		}
+		else
+		{
+			ListNode* current = front;
+			while (current->next != nullptr && current->next->priority < priority)
+			{
+				current = current->next;
+			}
+
+			new_node->next = current->next;
+			current->next = new_node;
+		}
+	}
+
+	void dequeue()
+	{
+		ListNode* temp = front;
+		front = front->next;
+		delete temp;
+	}
+
+	int peek()
+	{
+		return front->data;
+	}
+
+	bool is_empty()
+	{
+		return front == nullptr;
+	}
+};
+
+// n 개를 삽입한 뒤 모두 꺼내는 시간(밀리초)을 측정합니다.
+template <typename Queue>
+double measure_ms(const vector<int>& priorities, long long& checksum)
+{
+	Queue pq;
+
+	auto start = chrono::steady_clock::now();
+	for (size_t i = 0; i < priorities.size(); i++)
+	{
+		pq.enqueue(static_cast<int>(i), priorities[i]);
+	}
+	while (!pq.is_empty())
+	{
+		checksum += pq.peek();
+		pq.dequeue();
+	}
+	chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+	return elapsed.count();
+}
+
+int main()
+{
+	PriorityQueue pq;
+
+	cout << "큐에 값을 추가합니다: 10(2), 20(4), 30(4), 40(3)" << endl;
+	pq.enqueue(10, 2);
+	pq.enqueue(20, 4);
+	pq.enqueue(30, 4);
+	pq.enqueue(40, 3);
+
+	cout << "현재 큐의 가장 앞의 값: " << pq.peek() << endl;
+
+	cout << "\n큐에서 두 개의 값을 제거합니다." << endl;
+	pq.dequeue();
+	pq.dequeue();
+
+	cout << "현재 큐의 앞의 값: " << pq.peek() << endl;
+
+	cout << "\n큐에서 남은 값들을 모두 제거합니다..." << endl;
+	pq.dequeue();
+	pq.dequeue();
+
+	cout << "큐가 비어있습니까?: " << (pq.is_empty() ? "네" : "아니오") << endl;
+
+	cout << "\n비어있는 큐에서 peek() 호출 시도..." << endl;
+	try
+	{
+		cout << "현재 큐의 최상단 값: " << pq.peek() << endl;
+	}
+	catch (const exception& e)
+	{
+		cout << "(오류 발생) " << e.what() << endl;
+	}
+
+	// 벤치마크
+	/*
+	 * 무작위 우선순위로 n 개를 삽입한 뒤 모두 꺼냅니다.
+	 * 연결 리스트는 O(n^2)이므로 작은 크기에서만 측정합니다.
+	 */
+	mt19937 rng(42);
+	long long checksum = 0;
+
+	cout << "\n[삽입 후 모두 꺼내기]\n";
+	for (int n = 1000; n <= 1024000; n *= 4)
+	{
+		vector<int> priorities(n);
+		for (int& priority : priorities)
+		{
+			priority = static_cast<int>(rng() % 1000000);
+		}
+
+		cout << "요소 " << n << "개 - Skip list: " << measure_ms<PriorityQueue>(priorities, checksum) << "ms";
+		if (n <= 16000)
+		{
+			cout << ", Linked list: " << measure_ms<LinkedListQueue>(priorities, checksum) << "ms";
+		}
+		cout << '\n';
+	}
+	cout << "(checksum " << checksum << ")" << endl;
+
+	return 0;
+}
@@ -0,0 +1,488 @@
+/*
+ * 계층적 타이밍 휠 (Hierarchical Timing Wheel)
+ *
+ * 우선순위 큐(이진 힙)로 타이머를 관리하면 등록(arm)과 취소(cancel)가 모두
+ * O(log n)입니다. 연결 타임아웃처럼 대부분의 타이머가 만료되기 전에 취소되는
+ * 경우에는 만료 순서를 정렬해 두는 비용 대부분이 낭비됩니다.
+ *
+ * 타이밍 휠은 시계처럼 슬롯(slot)을 원형으로 배치하고, 만료 시각에 해당하는
+ * 슬롯의 목록에 타이머를 넣습니다. 한 틱(tick)이 지날 때마다 바늘이 한 칸
+ * 이동하며 그 슬롯의 타이머를 한꺼번에 만료시킵니다.
+ *
+ * 슬롯 256개짜리 휠을 4단계로 쌓아 2^32 틱까지 표현합니다.
+ * - 0단계: 앞으로 256틱 이내에 만료되는 타이머 (슬롯 하나 = 1틱)
+ * - 1단계: 2^16틱 이내 (슬롯 하나 = 256틱)
+ * - 2단계, 3단계: 같은 방식으로 256배씩 넓어집니다.
+ * 아래 단계의 바늘이 한 바퀴 돌 때마다 위 단계의 다음 슬롯에 있는 타이머들을
+ * 남은 시간에 맞는 아래 단계로 다시 나눠 넣습니다(cascading).
+ *
+ * 타이머는 슬롯마다 이중 연결 리스트로 연결되어 등록과 취소는 O(1)이고,
+ * 각 타이머는 만료될 때까지 단계 수(4) 이하로만 이동합니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+using namespace std;
+
+class TimingWheel
+{
+	static constexpr int LEVELS = 4;
+	static constexpr int SLOT_BITS = 8;
+	static constexpr int SLOTS = 1 << SLOT_BITS;
+	static constexpr uint64_t SLOT_MASK = SLOTS - 1;
+	static constexpr uint64_t MAX_DELAY = (1ull << (SLOT_BITS * LEVELS)) - 1;
+	static constexpr uint32_t NIL = UINT32_MAX;
+
+	// 타이머 노드 (배열 인덱스로 연결)
+	struct Timer
+	{
+		uint64_t expires;
+		int id;
+		uint32_t prev;
+		uint32_t next;
+		uint32_t list;       // 속한 슬롯 번호 (level * SLOTS + slot), 사용 중이 아니면 NIL
+		uint32_t generation; // 노드가 재사용될 때마다 증가
+	};
+
+	vector<Timer> timers;
+	vector<uint32_t> heads; // 슬롯별 목록의 첫 노드
+	uint32_t freeHead;      // 재사용할 노드 목록 (next 로 연결)
+	uint64_t now;
+	size_t count;
+	vector<int> expiredBatch;
+
+public:
+	// 타이머 핸들 (상위 32비트: 세대, 하위 32비트: 노드 번호)
+	using Handle = uint64_t;
+
+	TimingWheel() : heads(LEVELS * SLOTS, NIL), freeHead(NIL), now(0), count(0)
+	{
+	}
+
+	// 타이머 등록
+	/*
+	 * delay 틱 뒤에 id 를 만료시킵니다. (delay 가 0이면 다음 틱)
+	 * 시간 복잡도: O(1)
+	 */
+	Handle arm(uint64_t delay, int id)
+	{
+		uint32_t index = allocate();
+		Timer& timer = timers[index];
+		timer.expires = now + (delay == 0 ? 1 : delay);
+		timer.id = id;
+		link(index);
+		count++;
+
+		return (static_cast<uint64_t>(timer.generation) << 32) | index;
+	}
+
+	// 타이머 취소
+	/*
+	 * 이미 만료되었거나 취소된 타이머라면 false 를 반환합니다.
+	 * 시간 복잡도: O(1)
+	 */
+	bool cancel(Handle handle)
+	{
+		uint32_t index = static_cast<uint32_t>(handle);
+		uint32_t generation = static_cast<uint32_t>(handle >> 32);
+
+		if (index >= timers.size() || timers[index].generation != generation ||
+			timers[index].list == NIL)
+		{
+			return false;
+		}
+
+		unlink(index);
+		release(index);
+		count--;
+		return true;
+	}
+
+	// 시간 진행
+	/*
+	 * ticks 틱만큼 바늘을 움직이며, 틱마다 만료된 타이머들의 id 를 모아
+	 * on_expire(id) 를 호출합니다. 콜백 안에서 새 타이머를 등록하거나 다른
+	 * 타이머를 취소해도 됩니다.
+	 * 시간 복잡도: 틱당 O(1) + 만료/이동하는 타이머 수
+	 * @return 만료된 타이머 수
+	 */
+	template <typename Callback>
+	size_t advance(uint64_t ticks, Callback on_expire)
+	{
+		size_t expired = 0;
+
+		for (uint64_t t = 0; t < ticks; t++)
+		{
+			now++;
+			cascade();
+
+			// 현재 슬롯의 목록을 통째로 떼어 내 한꺼번에 만료시킵니다.
+			uint32_t slot = static_cast<uint32_t>(now & SLOT_MASK);
+			uint32_t index = heads[slot];
+			heads[slot] = NIL;
+
+			expiredBatch.clear();
+			while (index != NIL)
+			{
+				uint32_t next = timers[index].next;
+				expiredBatch.push_back(timers[index].id);
+				release(index);
+				index = next;
+			}
+
+			count -= expiredBatch.size();
+			expired += expiredBatch.size();
+			for (int id : expiredBatch)
+			{
+				on_expire(id);
+			}
+		}
+
+		return expired;
+	}
+
+	uint64_t current_tick()
+	{
+		return now;
+	}
+
+	size_t size()
+	{
+		return count;
+	}
+
+private:
+	uint32_t allocate()
+	{
+		if (freeHead != NIL)
+		{
+			uint32_t index = freeHead;
+			freeHead = timers[index].next;
+			return index;
+		}
+
+		timers.push_back({ 0, 0, NIL, NIL, NIL, 0 });
+		return static_cast<uint32_t>(timers.size() - 1);
+	}
+
+	void release(uint32_t index)
+	{
+		Timer& timer = timers[index];
+		timer.list = NIL;
+		timer.generation++;
+		timer.next = freeHead;
+		freeHead = index;
+	}
+
+	// 남은 시간에 맞는 단계와 슬롯의 목록 앞에 연결합니다.
+	void link(uint32_t index)
+	{
+		Timer& timer = timers[index];
+		uint64_t delta = timer.expires - now;
+		uint64_t expires = timer.expires;
+
+		// 표현 범위를 넘는 타이머는 가장 높은 단계의 마지막 슬롯에 두었다가
+		// 그 슬롯이 다시 나눠질 때 남은 시간으로 다시 배치됩니다.
+		if (delta > MAX_DELAY)
+		{
+			delta = MAX_DELAY;
+			expires = now + MAX_DELAY;
+		}
+
+		int level = 0;
+		while (level < LEVELS - 1 && delta >= (1ull << (SLOT_BITS * (level + 1))))
+		{
+			level++;
+		}
+
+		uint32_t list = level * SLOTS + static_cast<uint32_t>((expires >> (SLOT_BITS * level)) & SLOT_MASK);
+		timer.list = list;
+		timer.prev = NIL;
+		timer.next = heads[list];
+		if (heads[list] != NIL)
+		{
+			timers[heads[list]].prev = index;
+		}
+		heads[list] = index;
+	}
+
+	void unlink(uint32_t index)
+	{
+		Timer& timer = timers[index];
+		if (timer.prev != NIL)
+		{
+			timers[timer.prev].next = timer.next;
+		}
+		else
+		{
+			heads[timer.list] = timer.next;
+		}
+
+		if (timer.next != NIL)
+		{
+			timers[timer.next].prev = timer.prev;
+		}
+	}
+
+	// 단계 간 이동
+	/*
+	 * 현재 시각의 하위 8*l 비트가 모두 0이면 l단계 휠의 바늘이 다음 슬롯에
+	 * 도달한 것입니다. 높은 단계부터 그 슬롯의 타이머들을 남은 시간에 맞는
+	 * 낮은 단계로 다시 배치합니다.
+	 */
+	void cascade()
+	{
+		int top = 0;
+		while (top < LEVELS - 1 && ((now >> (SLOT_BITS * (top + 1))) << (SLOT_BITS * (top + 1))) == now)
+		{
+			top++;
+		}
+
+		for (int level = top; level >= 1; level--)
+		{
+			uint32_t list = level * SLOTS + static_cast<uint32_t>((now >> (SLOT_BITS * level)) & SLOT_MASK);
+			uint32_t index = heads[list];
+			heads[list] = NIL;
+
+			while (index != NIL)
+			{
+				uint32_t next = timers[index].next;
+				link(index);
+				index = next;
+			}
+		}
+	}
+};
+
+// 비교용: 인덱스 이진 힙 기반 타이머 (IndexedBinaryHeapPriorityQueue.cpp 와 같은 구조)
+/*
+ * 만료 시각이 가장 이른 타이머가 루트에 있으며, 노드마다 힙에서의 위치를
+ * 기록해 취소도 O(log n)에 처리합니다.
+ */
+class HeapTimer
+{
+	struct Node
+	{
+		uint64_t expires;
+		int id;
+		int position;        // 힙 배열에서의 위치, 사용 중이 아니면 -1
+		uint32_t generation; // 노드가 재사용될 때마다 증가
+	};
+
+	vector<int> heap;
+	vector<Node> nodes;
+	vector<int> freeNodes;
+	uint64_t now = 0;
+
+public:
+	// 타이머 핸들 (상위 32비트: 세대, 하위 32비트: 노드 번호)
+	using Handle = uint64_t;
+
+	Handle arm(uint64_t delay, int id)
+	{
+		int index;
+		if (freeNodes.empty())
+		{
+			index = static_cast<int>(nodes.size());
+			nodes.push_back({});
+		}
+		else
+		{
+			index = freeNodes.back();
+			freeNodes.pop_back();
+		}
+
+		Node& node = nodes[index];
+		node.expires = now + (delay == 0 ? 1 : delay);
+		node.id = id;
+		node.position = static_cast<int>(heap.size());
+		heap.push_back(index);
+		shift_up(heap.size() - 1);
+		return (static_cast<uint64_t>(node.generation) << 32) | static_cast<uint32_t>(index);
+	}
+
+	bool cancel(Handle handle)
+	{
+		uint32_t index = static_cast<uint32_t>(handle);
+		uint32_t generation = static_cast<uint32_t>(handle >> 32);
+
+		if (index >= nodes.size() || nodes[index].generation != generation ||
+			nodes[index].position == -1)
+		{
+			return false;
+		}
+		remove_at(nodes[index].position);
+		return true;
+	}
+
+	template <typename Callback>
+	size_t advance(uint64_t ticks, Callback on_expire)
+	{
+		size_t expired = 0;
+		for (uint64_t t = 0; t < ticks; t++)
+		{
+			now++;
+			while (!heap.empty() && nodes[heap[0]].expires <= now)
+			{
+				int id = nodes[heap[0]].id;
+				remove_at(0);
+				on_expire(id);
+				expired++;
+			}
+		}
+		return expired;
+	}
+
+private:
+	bool earlier(int a, int b)
+	{
+		return nodes[heap[a]].expires < nodes[heap[b]].expires;
+	}
+
+	void swap_nodes(size_t a, size_t b)
+	{
+		swap(heap[a], heap[b]);
+		nodes[heap[a]].position = static_cast<int>(a);
+		nodes[heap[b]].position = static_cast<int>(b);
+	}
+
+	void remove_at(size_t index)
+	{
+		int removed = heap[index];
+		swap_nodes(index, heap.size() - 1);
+		heap.pop_back();
+		nodes[removed].position = -1;
+		nodes[removed].generation++;
+		freeNodes.push_back(removed);
+
+		if (index < heap.size())
+		{
+			shift_up(index);
+			shift_down(index);
+		}
+	}
+
+	void shift_up(size_t index)
+	{
+		while (index > 0 && earlier(index, (index - 1) / 2))
+		{
+			swap_nodes(index, (index - 1) / 2);
+			index = (index - 1) / 2;
+		}
+	}
+
+	void shift_down(size_t index)
+	{
+		while (true)
+		{
+			size_t best = index;
+			size_t left = 2 * index + 1;
+			size_t right = left + 1;
+			if (left < heap.size() && earlier(left, best))
+			{
+				best = left;
+			}
+			if (right < heap.size() && earlier(right, best))
+			{
+				best = right;
+			}
+			if (best == index)
+			{
+				return;
+			}
+			swap_nodes(index, best);
+			index = best;
+		}
+	}
+};
+
+// 연결 타임아웃 시뮬레이션
+/*
+ * 매 틱마다 armPerTick 개의 타이머를 1~maxTimeout 틱 뒤로 등록하고,
+ * cancelPercent% 의 타이머는 만료되기 전의 무작위 시각에 취소합니다.
+ * 두 구현 모두 같은 난수열로 같은 작업을 수행합니다.
+ * @return 경과 시간(밀리초)
+ */
+template <typename Timers>
+double simulate(int ticks, int armPerTick, int maxTimeout, int cancelPercent, size_t& fired)
+{
+	Timers timers;
+	mt19937 rng(1);
+	vector<vector<typename Timers::Handle>> cancelAt(ticks + maxTimeout + 1);
+	fired = 0;
+
+	auto start = chrono::steady_clock::now();
+	for (int tick = 0; tick < ticks; tick++)
+	{
+		for (int i = 0; i < armPerTick; i++)
+		{
+			int timeout = 1 + rng() % maxTimeout;
+			auto handle = timers.arm(timeout, i);
+
+			if ((int)(rng() % 100) < cancelPercent)
+			{
+				cancelAt[tick + rng() % timeout].push_back(handle);
+			}
+		}
+
+		for (auto handle : cancelAt[tick])
+		{
+			timers.cancel(handle);
+		}
+		cancelAt[tick].clear();
+
+		fired += timers.advance(1, [](int) {});
+	}
+	chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+	return elapsed.count();
+}
+
+int main()
+{
+	TimingWheel wheel;
+
+	cout << "타이머를 등록합니다: A(3틱), B(300틱), C(70000틱), D(5틱)" << endl;
+	wheel.arm(3, 'A');
+	wheel.arm(300, 'B');
+	wheel.arm(70000, 'C');
+	auto d = wheel.arm(5, 'D');
+
+	cout << "D를 취소합니다: " << (wheel.cancel(d) ? "성공" : "실패") << endl;
+	cout << "D를 다시 취소합니다: " << (wheel.cancel(d) ? "성공" : "실패") << endl;
+
+	cout << "\n100000틱 동안 진행합니다." << endl;
+	wheel.advance(100000, [&](int id)
+		{
+			cout << "  " << wheel.current_tick() << "틱: " << (char)id << " 만료" << endl;
+		});
+	cout << "남은 타이머 수: " << wheel.size() << endl;
+
+	// 벤치마크
+	/*
+	 * 틱마다 100개씩 20000틱 동안 200만 개의 타이머를 등록하며, 만료 시간은
+	 * 최대 30000틱입니다. (동시에 살아 있는 타이머는 최대 약 150만 개)
+	 */
+	const int TICKS = 20000;
+	const int ARM_PER_TICK = 100;
+	const int MAX_TIMEOUT = 30000;
+
+	cout << "\n[타이머 " << TICKS * ARM_PER_TICK << "개 등록, 취소 비율별 시간]\n";
+	for (int cancelPercent : { 0, 50, 90, 99 })
+	{
+		size_t wheelFired, heapFired;
+		double wheelMs = simulate<TimingWheel>(TICKS, ARM_PER_TICK, MAX_TIMEOUT, cancelPercent, wheelFired);
+		double heapMs = simulate<HeapTimer>(TICKS, ARM_PER_TICK, MAX_TIMEOUT, cancelPercent, heapFired);
+
+		cout << "취소 " << cancelPercent << "% - Timing wheel: " << wheelMs << "ms, Binary heap: "
+			<< heapMs << "ms (만료 " << wheelFired << " / " << heapFired << ")\n";
+	}
+
+	return 0;
+}
@@ -0,0 +1,300 @@
+/*
+ * 힙 기반 상위 K개 선택기 (Top-K Selector)
+ *
+ * 아주 많은 값 중 가장 큰 K개만 필요할 때, 전부 정렬하거나 전부 우선순위
+ * 큐에 넣으면 O(n log n)의 시간과 O(n)의 메모리를 사용합니다.
+ *
+ * 크기가 K로 고정된 최소 힙을 두면, 힙의 루트는 "지금까지의 상위 K개 중
+ * 가장 작은 값"이 됩니다. 새 값이 루트보다 크지 않으면 바로 버리고(빠른 거절),
+ * 크다면 루트를 새 값으로 바꾼 뒤 아래로 재정렬합니다.
+ * 시간 복잡도는 O(n log K), 메모리는 O(K)입니다.
+ *
+ * 데이터가 무작위라면 처리가 진행될수록 루트가 커져 대부분의 값이 비교 한 번에
+ * 거절됩니다. 배열을 한꺼번에 넘기는 offer(values, count)는 값을 작은 묶음으로
+ * 나눠 묶음의 최댓값부터 구하므로(벡터화하기 쉬운 반복문), 루트보다 큰 값이
+ * 없는 묶음은 통째로 건너뜁니다.
+ *
+ * 여러 스레드에서는 스레드마다 선택기를 따로 두고 마지막에 merge 로 합칩니다.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <random>
+#include <chrono>
+#include <stdexcept>
+
+using namespace std;
+
+template <typename T = int>
+class TopKSelector
+{
+	static constexpr size_t CHUNK = 64;
+
+	size_t k;
+	vector<T> heap; // 최소 힙: heap[0] 이 상위 K개 중 가장 작은 값
+
+public:
+	explicit TopKSelector(size_t k) : k(k)
+	{
+		if (k == 0)
+		{
+			throw invalid_argument("K must be positive");
+		}
+		heap.reserve(k);
+	}
+
+	// 값 하나 제안
+	/*
+	 * 시간 복잡도: 거절 시 O(1), 채택 시 O(log K)
+	 */
+	void offer(const T& value)
+	{
+		if (heap.size() < k)
+		{
+			heap.push_back(value);
+			shift_up(heap.size() - 1);
+		}
+		else if (heap[0] < value)
+		{
+			shift_down(0, value);
+		}
+	}
+
+	// 여러 값 한꺼번에 제안
+	/*
+	 * 힙이 가득 찬 뒤에는 CHUNK 개씩 묶어 최댓값을 먼저 구하고, 그 값이
+	 * 루트보다 크지 않으면 묶음 전체를 건너뜁니다.
+	 */
+	void offer(const T* values, size_t count)
+	{
+		size_t i = 0;
+		for (; i < count && heap.size() < k; i++)
+		{
+			offer(values[i]);
+		}
+
+		for (; i + CHUNK <= count; i += CHUNK)
+		{
+			if (heap[0] < chunk_max(values + i))
+			{
+				for (size_t j = i; j < i + CHUNK; j++)
+				{
+					if (heap[0] < values[j])
+					{
+						shift_down(0, values[j]);
+					}
+				}
+			}
+		}
+
+		for (; i < count; i++)
+		{
+			offer(values[i]);
+		}
+	}
+
+	// 다른 선택기의 결과 합치기
+	/*
+	 * 시간 복잡도: O(K log K)
+	 */
+	void merge(const TopKSelector& other)
+	{
+		offer(other.heap.data(), other.heap.size());
+	}
+
+	// 현재 가장 작은 상위 K개 값 (이 값보다 크지 않은 값은 거절됩니다)
+	const T& threshold() const
+	{
+		if (heap.empty())
+		{
+			throw runtime_error("Selector is empty");
+		}
+		return heap[0];
+	}
+
+	size_t size() const
+	{
+		return heap.size();
+	}
+
+	// 상위 K개를 내림차순으로 반환합니다.
+	vector<T> result() const
+	{
+		vector<T> sorted = heap;
+		sort(sorted.begin(), sorted.end(), greater<T>());
+		return sorted;
+	}
+
+private:
+	// 묶음의 최댓값 (분기 없는 반복문이라 컴파일러가 벡터화하기 쉽습니다)
+	static T chunk_max(const T* values)
+	{
+		T best = values[0];
+		for (size_t j = 1; j < CHUNK; j++)
+		{
+			best = best < values[j] ? values[j] : best;
+		}
+		return best;
+	}
+
+	// 부모보다 작은 동안 빈 자리를 위로 옮깁니다.
+	void shift_up(size_t index)
+	{
+		T value = heap[index];
+		while (index > 0 && value < heap[(index - 1) / 2])
+		{
+			heap[index] = heap[(index - 1) / 2];
+			index = (index - 1) / 2;
+		}
+		heap[index] = value;
+	}
+
+	// value 를 index 위치에 놓는다고 보고, 더 작은 자식이 있는 동안 빈 자리를
+	// 아래로 옮깁니다.
+	void shift_down(size_t index, T value)
+	{
+		size_t size = heap.size();
+		while (true)
+		{
+			size_t child = 2 * index + 1;
+			if (child >= size)
+			{
+				break;
+			}
+			if (child + 1 < size && heap[child + 1] < heap[child])
+			{
+				child++;
+			}
+			if (!(heap[child] < value))
+			{
+				break;
+			}
+			heap[index] = heap[child];
+			index = child;
+		}
+		heap[index] = value;
+	}
+};
+
+// 병렬 상위 K개 선택
+/*
+ * 배열을 threadCount 개의 구간으로 나눠 스레드마다 선택기를 두고, 모든
+ * 스레드가 끝나면 결과를 하나로 합칩니다.
+ */
+template <typename T>
+TopKSelector<T> parallel_top_k(const T* values, size_t count, size_t k, int threadCount)
+{
+	vector<TopKSelector<T>> locals(threadCount, TopKSelector<T>(k));
+	vector<thread> workers;
+
+	size_t per_thread = (count + threadCount - 1) / threadCount;
+	for (int t = 0; t < threadCount; t++)
+	{
+		size_t begin = min(count, t * per_thread);
+		size_t end = min(count, begin + per_thread);
+		workers.emplace_back([&locals, values, t, begin, end]
+			{
+				locals[t].offer(values + begin, end - begin);
+			});
+	}
+
+	for (thread& worker : workers)
+	{
+		worker.join();
+	}
+
+	for (int t = 1; t < threadCount; t++)
+	{
+		locals[0].merge(locals[t]);
+	}
+	return locals[0];
+}
+
+int main()
+{
+	TopKSelector<int> selector(3);
+
+	cout << "값을 차례로 제안합니다: 5, 1, 9, 3, 7, 2, 8 (K = 3)" << endl;
+	for (int value : { 5, 1, 9, 3, 7, 2, 8 })
+	{
+		selector.offer(value);
+	}
+
+	cout << "상위 3개: ";
+	for (int value : selector.result())
+	{
+		cout << value << " ";
+	}
+	cout << "\n현재 거절 기준값: " << selector.threshold() << endl;
+
+	// 벤치마크
+	/*
+	 * 무작위 점수 N 개 중 상위 K 개를 구합니다.
+	 */
+	const size_t N = 50000000;
+	const size_t K = 1000;
+	mt19937 rng(42);
+
+	vector<int> scores(N);
+	for (int& score : scores)
+	{
+		score = static_cast<int>(rng() >> 1);
+	}
+
+	cout << "\n[점수 " << N << "개 중 상위 " << K << "개]\n";
+	auto report = [&](const char* name, auto&& run)
+	{
+		auto start = chrono::steady_clock::now();
+		int kth = run();
+		auto elapsed = chrono::steady_clock::now() - start;
+		cout << "  " << name << " - " << chrono::duration_cast<chrono::milliseconds>(elapsed).count()
+			<< "ms (K번째 값 " << kth << ")\n";
+	};
+
+	report("전체 정렬       ", [&]
+		{
+			vector<int> copy = scores;
+			sort(copy.begin(), copy.end(), greater<int>());
+			return copy[K - 1];
+		});
+
+	report("priority_queue  ", [&]
+		{
+			priority_queue<int> pq(scores.begin(), scores.end());
+			for (size_t i = 0; i < K - 1; i++)
+			{
+				pq.pop();
+			}
+			return pq.top();
+		});
+
+	report("offer(하나씩)   ", [&]
+		{
+			TopKSelector<int> top(K);
+			for (int score : scores)
+			{
+				top.offer(score);
+			}
+			return top.threshold();
+		});
+
+	report("offer(배열)     ", [&]
+		{
+			TopKSelector<int> top(K);
+			top.offer(scores.data(), scores.size());
+			return top.threshold();
+		});
+
+	int threads = max(1u, thread::hardware_concurrency());
+	report("스레드별 + merge", [&]
+		{
+			return parallel_top_k(scores.data(), scores.size(), K, threads).threshold();
+		});
+
+	return 0;
+}
@@ -1,58 +1,269 @@
 /*
  * 동적 배열 기반 큐
  *
- * 동적 배열(std::vector)을 감싸 간단하게 큐를 구현합니다.
- * 학습용 예제이기 때문에 실전에서는 성능상 제한이 있습니다.
- * 
+ * 동적 배열(std::vector)을 감싸 큐를 구현하면 dequeue 때 앞부분을 지워야
+ * 하므로 내부 요소들이 한 칸씩 이동해 O(n)이 걸립니다.
+ *
+ * 여기서는 배열을 원형 큐(CircularQueue.cpp)처럼 사용하되, 가득 차면 두 배
+ * 크기의 배열로 옮겨 용량 제한을 없앱니다. 요소는 움직이지 않고 front 만
+ * 이동하므로 enqueue 와 dequeue 모두 분할 상환 O(1)입니다.
+ *
+ * 원형 배열에서 요소들은 최대 두 개의 연속 구간(front ~ 배열 끝, 배열 처음 ~
+ * rear)에 나뉘어 있습니다. 배열을 옮기거나 여러 요소를 한꺼번에 넣고 뺄 때는
+ * 구간 단위로 복사하므로, 단순한 타입이라면 memcpy 와 같은 속도로 처리됩니다.
+ *
  */
 
 #include <iostream>
 #include <vector>
+#include <queue>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
 
 using namespace std;
 
+template <typename T = int>
 class Queue
 {
-    vector<int> q;
+    static constexpr size_t MIN_CAPACITY = 8;
+
+    unique_ptr<T[]> arr;
+    size_t front;
+    size_t size;
+    size_t capacity;
 
 public:
-    void enqueue(int new_data)
+    Queue() : front(0), size(0), capacity(0)
     {
-        q.push_back(new_data);
     }
 
+    // 삽입
+    /*
+     * 가득 찼다면 두 배 크기로 늘린 뒤 삽입합니다. new_data 가 큐 안의 요소
+     * (예: q.enqueue(q.peek()))일 수 있으므로, 늘리기 전에 먼저 복사해 둡니다.
+     * 시간 복잡도: 분할 상환 O(1)
+     */
+    void enqueue(const T &new_data)
+    {
+        if (size == capacity)
+        {
+            T copied(new_data);
+            reallocate(max(MIN_CAPACITY, capacity * 2));
+            arr[size] = move(copied);
+        }
+        else
+        {
+            arr[wrap(front + size)] = new_data;
+        }
+        size++;
+    }
+
+    // 여러 값 삽입
     /*
-     * vector의 앞부분을 지우면 내부 요소들이 한 칸씩 이동하므로
-     * 시간 복잡도가 O(n)입니다. 아래와 같은 구현에서 잦은 dequeue
-     * 호출은 비효율적이기 때문에 실전에서 사용하기엔 무리가 있습니다.
+     * 필요한 만큼 한 번에 늘린 뒤, 빈 공간의 두 구간에 나눠 복사합니다.
+     * values 가 큐 안을 가리킨다면 늘리기 전에 먼저 복사해 둡니다.
+     * 시간 복잡도: 분할 상환 O(k) (k: 넣은 개수)
+     */
+    void enqueue(const T *values, size_t count)
+    {
+        vector<T> copied;
+        if (size + count > capacity)
+        {
+            if (less_equal<const T *>()(arr.get(), values) && less<const T *>()(values, arr.get() + capacity))
+            {
+                copied.assign(values, values + count);
+                values = copied.data();
+            }
+            reallocate(max({ MIN_CAPACITY, capacity * 2, size + count }));
+        }
+
+        size_t rear = wrap(front + size);
+        size_t first = min(count, capacity - rear);
+        copy(values, values + first, arr.get() + rear);
+        copy(values + first, values + count, arr.get());
+        size += count;
+    }
+
+    // 삭제
+    /*
+     * front 만 한 칸 옮기므로 요소들이 이동하지 않습니다.
+     * 시간 복잡도: O(1)
      */
     void dequeue()
     {
         if (!is_empty())
         {
-            q.erase(q.begin());
+            front = wrap(front + 1);
+            size--;
         }
     }
 
-    int peek()
+    // 여러 값 삭제
+    /*
+     * 앞에서부터 최대 count 개를 out 에 옮기고, 꺼낸 개수를 반환합니다.
+     * 시간 복잡도: O(k) (k: 꺼낸 개수)
+     */
+    size_t dequeue(T *out, size_t count)
+    {
+        size_t n = min(count, size);
+        size_t first = min(n, capacity - front);
+        move(arr.get() + front, arr.get() + front + first, out);
+        move(arr.get(), arr.get() + (n - first), out + first);
+
+        front = wrap(front + n);
+        size -= n;
+        return n;
+    }
+
+    const T &peek()
     {
         if (is_empty())
         {
             throw runtime_error("Queue is empty");
         }
 
-        return q.front();
+        return arr[front];
+    }
+
+    // 최소 n 개를 저장할 수 있도록 미리 늘립니다.
+    void reserve(size_t n)
+    {
+        if (n > capacity)
+        {
+            reallocate(n);
+        }
+    }
+
+    // 용량을 요소 수에 맞게 줄입니다. (비어 있으면 배열을 해제합니다)
+    void shrink_to_fit()
+    {
+        if (size < capacity)
+        {
+            reallocate(size);
+        }
     }
 
     bool is_empty()
     {
-        return q.empty();
+        return size == 0;
+    }
+
+    size_t get_size()
+    {
+        return size;
+    }
+
+    size_t get_capacity()
+    {
+        return capacity;
+    }
+
+private:
+    // front + offset 처럼 배열 크기를 넘지 않는 값만 들어오므로 나머지 연산 대신
+    // 한 번 빼는 것으로 충분합니다.
+    size_t wrap(size_t index)
+    {
+        return index >= capacity ? index - capacity : index;
+    }
+
+    // 배열 옮기기
+    /*
+     * 두 구간(front ~ 배열 끝, 배열 처음 ~ rear)을 차례로 새 배열의 앞쪽에
+     * 옮겨 front 를 0으로 맞춥니다.
+     * 시간 복잡도: O(n)
+     */
+    void reallocate(size_t new_capacity)
+    {
+        unique_ptr<T[]> new_arr(new_capacity == 0 ? nullptr : new T[new_capacity]);
+
+        size_t first = min(size, capacity - front);
+        move(arr.get() + front, arr.get() + front + first, new_arr.get());
+        move(arr.get(), arr.get() + (size - first), new_arr.get() + first);
+
+        arr = move(new_arr);
+        front = 0;
+        capacity = new_capacity;
     }
 };
 
+// 비교용: vector 의 앞부분을 지우는 큐 (이전 구현)
+class VectorQueue
+{
+    vector<int> q;
+
+public:
+    void enqueue(int new_data)
+    {
+        q.push_back(new_data);
+    }
+
+    void dequeue()
+    {
+        if (!q.empty())
+        {
+            q.erase(q.begin());
+        }
+    }
+
+    int peek()
+    {
+        return q.front();
+    }
+};
+
+// 비교용: 표준 라이브러리 큐
+class StdQueue
+{
+    queue<int> q;
+
+public:
+    void enqueue(int new_data)
+    {
+        q.push(new_data);
+    }
+
+    void dequeue()
+    {
+        q.pop();
+    }
+
+    int peek()
+    {
+        return q.front();
+    }
+};
+
+// n 개를 넣어 둔 뒤, 하나 꺼내고 하나 넣기를 n 번 반복하는 시간(밀리초)
+/*
+ * 처음 채우는 시간은 배열을 늘리는 비용이 섞이므로 제외합니다.
+ */
+template <typename Q>
+double measure_ms(int n, long long &checksum)
+{
+    Q q;
+    for (int i = 0; i < n; i++)
+    {
+        q.enqueue(i);
+    }
+
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+    {
+        checksum += q.peek();
+        q.dequeue();
+        q.enqueue(i);
+    }
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
 int main()
 {
-    Queue q;
+    Queue<int> q;
 
     cout << "큐에 값을 추가합니다: 10, 20, 30" << endl;
     q.enqueue(10);
@@ -82,5 +293,41 @@ int main()
         cout << "(오류 발생) " << e.what() << endl;
     }
 
+    cout << "\n값 1~20을 한꺼번에 추가합니다." << endl;
+    int values[20];
+    for (int i = 0; i < 20; i++)
+    {
+        values[i] = i + 1;
+    }
+    q.enqueue(values, 20);
+    cout << "요소 수: " << q.get_size() << ", 용량: " << q.get_capacity() << endl;
+
+    int out[16];
+    size_t n = q.dequeue(out, 16);
+    cout << n << "개를 한꺼번에 꺼냈습니다. 현재 큐의 앞의 값: " << q.peek() << endl;
+
+    q.shrink_to_fit();
+    cout << "shrink_to_fit 후 요소 수: " << q.get_size() << ", 용량: " << q.get_capacity() << endl;
+
+    // 벤치마크
+    /*
+     * vector 의 앞부분을 지우는 이전 구현은 O(n^2)이므로 작은 크기에서만
+     * 측정합니다.
+     */
+    long long checksum = 0;
+
+    cout << "\n[n 개를 넣은 뒤 꺼내고 넣기 n 번]\n";
+    for (int size = 1000; size <= 4096000; size *= 4)
+    {
+        cout << "요소 " << size << "개 - 원형 배열: " << measure_ms<Queue<int>>(size, checksum)
+             << "ms, std::queue: " << measure_ms<StdQueue>(size, checksum) << "ms";
+        if (size <= 64000)
+        {
+            cout << ", vector::erase: " << measure_ms<VectorQueue>(size, checksum) << "ms";
+        }
+        cout << '\n';
+    }
+    cout << "(checksum " << checksum << ")" << endl;
+
     return 0;
 }
@@ -0,0 +1,667 @@
+/*
+ * 락-프리 연결 리스트 큐 (Michael-Scott Queue)
+ *
+ * 연결 리스트 기반 큐(LinkedListQueue.cpp)를 여러 스레드가 락 없이 동시에
+ * 넣고 꺼낼 수 있도록 만든 구조입니다. 크기 제한이 없습니다.
+ *
+ * 맨 앞에는 값을 담지 않는 더미(dummy) 노드를 두어 front 와 rear 가 서로 다른
+ * 노드를 가리키게 합니다.
+ * - enqueue: rear 노드의 next 를 nullptr 에서 새 노드로 CAS 한 뒤, rear 를
+ *   새 노드로 옮깁니다. rear 가 뒤처져 있으면 먼저 한 칸 옮겨 줍니다.
+ * - dequeue: front(더미)의 다음 노드의 값을 읽고 front 를 그 노드로 CAS 합니다.
+ *   다음 노드가 새 더미가 되고, 이전 더미는 반납합니다.
+ *
+ * 락이 없으므로 한 스레드가 노드를 반납하는 순간에도 다른 스레드가 그 노드를
+ * 읽고 있을 수 있습니다. 해저드 포인터(hazard pointer)로 이를 막습니다.
+ * - 노드를 읽기 전에 자신의 해저드 포인터에 그 주소를 공개합니다.
+ * - 반납한 노드는 바로 재사용하지 않고 모아 두었다가, 어떤 스레드의 해저드
+ *   포인터에도 없는 노드만 재사용합니다.
+ *
+ * 재사용할 노드는 스레드마다 빈 목록에 보관하며, 넘치면 BATCH 개씩 묶어 공용
+ * 보관소에 넘깁니다. 넣기만 하는 스레드는 보관소에서 묶음을 가져오므로, 큐의
+ * 크기가 일정해지면 더 이상 new 를 호출하지 않습니다.
+ *
+ */
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+
+using namespace std;
+
+template <typename T>
+struct Node
+{
+    T data;
+    atomic<Node *> next;
+};
+
+// 노드 관리자 (해저드 포인터 + 노드 재사용)
+/*
+ * 같은 타입의 모든 큐가 함께 사용합니다. 스레드마다 해저드 포인터 2개를 가진
+ * 기록(record)을 하나씩 차지하며, 기록은 스레드가 끝나면 다른 스레드가
+ * 이어서 사용합니다.
+ */
+template <typename T>
+class NodeDomain
+{
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr int HAZARDS = 2;
+    static constexpr size_t BATCH = 64;
+    static constexpr int POOL_SLOTS = 64;
+
+    struct alignas(CACHE_LINE) Record
+    {
+        atomic<Node<T> *> hazard[HAZARDS];
+        atomic<bool> active;
+        Record *next;
+    };
+
+    // 스레드별 상태
+    struct ThreadState
+    {
+        Record *record;
+        vector<Node<T> *> retired; // 반납했지만 아직 재사용할 수 없는 노드
+        Node<T> *freeList;         // 재사용할 수 있는 노드 (next 로 연결)
+        size_t freeCount;
+
+        ThreadState() : record(instance().acquire_record()), freeList(nullptr), freeCount(0)
+        {
+        }
+
+        // 스레드가 끝나면 남은 노드를 넘기고 기록을 놓아 줍니다.
+        ~ThreadState()
+        {
+            NodeDomain &domain = instance();
+            for (int i = 0; i < HAZARDS; i++)
+            {
+                record->hazard[i].store(nullptr);
+            }
+            domain.scan(*this);
+            domain.adopt_orphans(retired);
+
+            while (freeList != nullptr)
+            {
+                domain.give_batch(*this);
+            }
+            record->active.store(false, memory_order_release);
+        }
+    };
+
+    atomic<Record *> records;
+    atomic<int> recordCount;
+    atomic<Node<T> *> pool[POOL_SLOTS]; // 빈 노드 묶음 (BATCH 개가 next 로 연결)
+    atomic<size_t> allocated;
+
+    // 스레드가 끝날 때까지 해저드 포인터에 남아 있던 노드
+    mutex orphanLock;
+    vector<Node<T> *> orphans;
+    atomic<bool> hasOrphans;
+
+    NodeDomain() : records(nullptr), recordCount(0), allocated(0), hasOrphans(false)
+    {
+        for (auto &slot : pool)
+        {
+            slot.store(nullptr, memory_order_relaxed);
+        }
+    }
+
+    ~NodeDomain()
+    {
+        for (auto &slot : pool)
+        {
+            delete_chain(slot.load());
+        }
+        for (Node<T> *node : orphans)
+        {
+            delete node;
+        }
+        Record *record = records.load();
+        while (record != nullptr)
+        {
+            Record *next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+public:
+    static NodeDomain &instance()
+    {
+        static NodeDomain domain;
+        return domain;
+    }
+
+    static ThreadState &local()
+    {
+        thread_local ThreadState state;
+        return state;
+    }
+
+    // src 가 가리키는 노드를 slot 번 해저드 포인터로 보호한 뒤 반환합니다.
+    /*
+     * 공개한 뒤 src 가 그대로인지 확인해야, 공개하기 전에 반납된 노드를 읽는
+     * 일이 없습니다.
+     */
+    static Node<T> *protect(int slot, const atomic<Node<T> *> &src)
+    {
+        atomic<Node<T> *> &hazard = local().record->hazard[slot];
+        Node<T> *node = src.load();
+        while (true)
+        {
+            hazard.store(node);
+            Node<T> *again = src.load();
+            if (again == node)
+            {
+                return node;
+            }
+            node = again;
+        }
+    }
+
+    static void set_hazard(int slot, Node<T> *node)
+    {
+        local().record->hazard[slot].store(node);
+    }
+
+    static void clear_hazards()
+    {
+        ThreadState &state = local();
+        for (int i = 0; i < HAZARDS; i++)
+        {
+            state.record->hazard[i].store(nullptr, memory_order_release);
+        }
+    }
+
+    // 노드 할당 (빈 목록 -> 공용 보관소 -> new 순서)
+    static Node<T> *allocate()
+    {
+        ThreadState &state = local();
+        if (state.freeList == nullptr)
+        {
+            instance().take_batch(state);
+        }
+
+        Node<T> *node = state.freeList;
+        if (node == nullptr)
+        {
+            instance().allocated.fetch_add(1, memory_order_relaxed);
+            return new Node<T>{};
+        }
+
+        state.freeList = node->next.load(memory_order_relaxed);
+        state.freeCount--;
+        return node;
+    }
+
+    // 노드 반납
+    /*
+     * 모아 둔 노드가 기록 수에 비례하는 개수를 넘으면 해저드 포인터를 훑어
+     * 재사용할 수 있는 노드를 골라 냅니다. 훑는 비용이 반납한 노드 수에
+     * 나눠지므로 노드당 분할 상환 O(1)입니다.
+     */
+    static void retire(Node<T> *node)
+    {
+        ThreadState &state = local();
+        state.retired.push_back(node);
+
+        size_t threshold = max<size_t>(BATCH, 2 * HAZARDS * instance().recordCount.load(memory_order_relaxed));
+        if (state.retired.size() >= threshold)
+        {
+            instance().scan(state);
+        }
+    }
+
+    // 지금까지 new 로 만든 노드 수
+    static size_t allocated_count()
+    {
+        return instance().allocated.load();
+    }
+
+private:
+    Record *acquire_record()
+    {
+        for (Record *record = records.load(); record != nullptr; record = record->next)
+        {
+            bool expected = false;
+            if (!record->active.load(memory_order_relaxed) &&
+                record->active.compare_exchange_strong(expected, true))
+            {
+                return record;
+            }
+        }
+
+        Record *record = new Record;
+        for (int i = 0; i < HAZARDS; i++)
+        {
+            record->hazard[i].store(nullptr, memory_order_relaxed);
+        }
+        record->active.store(true, memory_order_relaxed);
+        record->next = records.load();
+        while (!records.compare_exchange_weak(record->next, record))
+        {
+        }
+        recordCount.fetch_add(1);
+        return record;
+    }
+
+    // 어떤 해저드 포인터에도 없는 반납 노드를 빈 목록으로 옮깁니다.
+    void scan(ThreadState &state)
+    {
+        if (hasOrphans.load(memory_order_relaxed))
+        {
+            lock_guard<mutex> guard(orphanLock);
+            state.retired.insert(state.retired.end(), orphans.begin(), orphans.end());
+            orphans.clear();
+            hasOrphans.store(false, memory_order_relaxed);
+        }
+
+        vector<Node<T> *> hazards;
+        for (Record *record = records.load(); record != nullptr; record = record->next)
+        {
+            for (int i = 0; i < HAZARDS; i++)
+            {
+                Node<T> *node = record->hazard[i].load();
+                if (node != nullptr)
+                {
+                    hazards.push_back(node);
+                }
+            }
+        }
+        sort(hazards.begin(), hazards.end());
+
+        size_t kept = 0;
+        for (Node<T> *node : state.retired)
+        {
+            if (binary_search(hazards.begin(), hazards.end(), node))
+            {
+                state.retired[kept++] = node;
+            }
+            else
+            {
+                node->next.store(state.freeList, memory_order_relaxed);
+                state.freeList = node;
+                state.freeCount++;
+            }
+        }
+        state.retired.resize(kept);
+
+        while (state.freeCount >= 2 * BATCH)
+        {
+            give_batch(state);
+        }
+    }
+
+    void adopt_orphans(vector<Node<T> *> &retired)
+    {
+        if (retired.empty())
+        {
+            return;
+        }
+        lock_guard<mutex> guard(orphanLock);
+        orphans.insert(orphans.end(), retired.begin(), retired.end());
+        retired.clear();
+        hasOrphans.store(true, memory_order_relaxed);
+    }
+
+    // 빈 목록에서 최대 BATCH 개를 떼어 공용 보관소의 빈 칸에 넣습니다.
+    // (빈 칸이 없으면 해제합니다)
+    void give_batch(ThreadState &state)
+    {
+        Node<T> *batch = state.freeList;
+        Node<T> *last = batch;
+        size_t count = 1;
+        while (count < BATCH && last->next.load(memory_order_relaxed) != nullptr)
+        {
+            last = last->next.load(memory_order_relaxed);
+            count++;
+        }
+        state.freeList = last->next.load(memory_order_relaxed);
+        state.freeCount -= count;
+        last->next.store(nullptr, memory_order_relaxed);
+
+        for (auto &slot : pool)
+        {
+            Node<T> *expected = nullptr;
+            if (slot.load(memory_order_relaxed) == nullptr &&
+                slot.compare_exchange_strong(expected, batch, memory_order_release))
+            {
+                return;
+            }
+        }
+        delete_chain(batch);
+    }
+
+    // 공용 보관소에서 묶음 하나를 통째로 가져옵니다.
+    /*
+     * exchange 로 칸을 비우며 가져오므로, 다른 스레드와 같은 묶음을 나눠 갖는
+     * 일이 없습니다.
+     */
+    void take_batch(ThreadState &state)
+    {
+        for (auto &slot : pool)
+        {
+            if (slot.load(memory_order_relaxed) == nullptr)
+            {
+                continue;
+            }
+
+            Node<T> *batch = slot.exchange(nullptr, memory_order_acquire);
+            if (batch != nullptr)
+            {
+                state.freeList = batch;
+                state.freeCount = 0;
+                for (Node<T> *node = batch; node != nullptr; node = node->next.load(memory_order_relaxed))
+                {
+                    state.freeCount++;
+                }
+                return;
+            }
+        }
+    }
+
+    static void delete_chain(Node<T> *node)
+    {
+        while (node != nullptr)
+        {
+            Node<T> *next = node->next.load(memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+};
+
+template <typename T>
+class Queue
+{
+    using Domain = NodeDomain<T>;
+    static constexpr size_t CACHE_LINE = 64;
+
+    alignas(CACHE_LINE) atomic<Node<T> *> front;
+    alignas(CACHE_LINE) atomic<Node<T> *> rear;
+
+public:
+    Queue()
+    {
+        Node<T> *dummy = Domain::allocate();
+        dummy->next.store(nullptr, memory_order_relaxed);
+        front.store(dummy);
+        rear.store(dummy);
+    }
+
+    // 다른 스레드가 사용하지 않을 때만 소멸시켜야 합니다.
+    ~Queue()
+    {
+        Node<T> *node = front.load();
+        while (node != nullptr)
+        {
+            Node<T> *next = node->next.load();
+            Domain::retire(node);
+            node = next;
+        }
+    }
+
+    Queue(const Queue &) = delete;
+    Queue &operator=(const Queue &) = delete;
+
+    // 삽입
+    /*
+     * 시간 복잡도: O(1) (경쟁이 없을 때)
+     */
+    void enqueue(const T &new_data)
+    {
+        Node<T> *new_node = Domain::allocate();
+        new_node->data = new_data;
+        new_node->next.store(nullptr, memory_order_relaxed);
+
+        while (true)
+        {
+            Node<T> *last = Domain::protect(0, rear);
+            Node<T> *next = last->next.load(memory_order_acquire);
+            if (last != rear.load())
+            {
+                continue;
+            }
+
+            if (next != nullptr)
+            {
+                // rear 가 뒤처져 있으면 옮겨 주고 다시 시도합니다.
+                rear.compare_exchange_weak(last, next);
+                continue;
+            }
+
+            if (last->next.compare_exchange_weak(next, new_node, memory_order_release, memory_order_relaxed))
+            {
+                rear.compare_exchange_strong(last, new_node);
+                break;
+            }
+        }
+
+        Domain::clear_hazards();
+    }
+
+    // 삭제
+    /*
+     * 앞의 값을 out 에 옮기고 제거합니다. 비어있다면 false 를 반환합니다.
+     * 시간 복잡도: O(1) (경쟁이 없을 때)
+     */
+    bool dequeue(T &out)
+    {
+        while (true)
+        {
+            Node<T> *first = Domain::protect(0, front);
+            Node<T> *last = rear.load();
+            Node<T> *next = first->next.load(memory_order_acquire);
+
+            // next 를 보호한 뒤에도 first 가 front 라면, next 는 아직 반납되지 않았습니다.
+            Domain::set_hazard(1, next);
+            if (first != front.load())
+            {
+                continue;
+            }
+
+            if (next == nullptr)
+            {
+                Domain::clear_hazards();
+                return false;
+            }
+
+            if (first == last)
+            {
+                rear.compare_exchange_weak(last, next);
+                continue;
+            }
+
+            T value = next->data;
+            if (front.compare_exchange_weak(first, next))
+            {
+                out = move(value);
+                Domain::clear_hazards();
+                Domain::retire(first);
+                return true;
+            }
+        }
+    }
+
+    // 다른 스레드가 동시에 수정 중일 수 있으므로 그 순간의 상태입니다.
+    bool is_empty()
+    {
+        Node<T> *first = Domain::protect(0, front);
+        bool empty = first->next.load(memory_order_acquire) == nullptr;
+        Domain::clear_hazards();
+        return empty;
+    }
+};
+
+// 비교용: 뮤텍스로 감싼 연결 리스트 큐 (LinkedListQueue.cpp 와 같은 구조)
+class LockedLinkedListQueue
+{
+    struct ListNode
+    {
+        int data;
+        ListNode *next;
+    };
+
+    ListNode *front = nullptr;
+    ListNode *rear = nullptr;
+    mutex lock;
+
+public:
+    ~LockedLinkedListQueue()
+    {
+        int value;
+        while (dequeue(value))
+        {
+        }
+    }
+
+    void enqueue(const int &new_data)
+    {
+        ListNode *new_node = new ListNode{ new_data, nullptr };
+
+        lock_guard<mutex> guard(lock);
+        if (front == nullptr)
+        {
+            front = new_node;
+            rear = new_node;
+            return;
+        }
+        rear->next = new_node;
+        rear = new_node;
+    }
+
+    bool dequeue(int &out)
+    {
+        ListNode *temp;
+        {
+            lock_guard<mutex> guard(lock);
+            if (front == nullptr)
+            {
+                return false;
+            }
+            temp = front;
+            front = front->next;
+            if (front == nullptr)
+            {
+                rear = nullptr;
+            }
+        }
+
+        out = temp->data;
+        delete temp;
+        return true;
+    }
+};
+
+// 스레드 threads 개가 각각 넣기와 꺼내기를 번갈아 perThread 번 하는 처리량(초당 연산 수)
+/*
+ * 큐에 미리 prefill 개를 넣어 두어 큐의 크기가 일정하게 유지됩니다.
+ */
+template <typename Q>
+double measure_throughput(int threads, long long perThread, int prefill, long long &checksum)
+{
+    Q q;
+    for (int i = 0; i < prefill; i++)
+    {
+        q.enqueue(i);
+    }
+
+    atomic<long long> sum(0);
+    vector<thread> workers;
+
+    auto start = chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&, t]
+            {
+                long long local = 0;
+                int value;
+                for (long long i = 0; i < perThread; i++)
+                {
+                    q.enqueue(t);
+                    while (!q.dequeue(value))
+                    {
+                    }
+                    local += value;
+                }
+                sum += local;
+            });
+    }
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    checksum += sum;
+    return 2.0 * threads * perThread / elapsed.count();
+}
+
+int main()
+{
+    Queue<int> q;
+
+    cout << "큐에 값을 추가합니다: 10, 20, 30" << endl;
+    q.enqueue(10);
+    q.enqueue(20);
+    q.enqueue(30);
+
+    int value;
+    q.dequeue(value);
+    cout << "꺼낸 값: " << value << endl;
+
+    cout << "\n네 스레드가 각각 값 100000개를 넣습니다." << endl;
+    vector<thread> producers;
+    for (int t = 0; t < 4; t++)
+    {
+        producers.emplace_back([&]
+            {
+                for (int i = 0; i < 100000; i++)
+                {
+                    q.enqueue(i);
+                }
+            });
+    }
+    for (thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    long long count = 0;
+    while (q.dequeue(value))
+    {
+        count++;
+    }
+    cout << "꺼낸 값의 개수: " << count << endl;
+    cout << "큐가 비어있습니까?: " << (q.is_empty() ? "네" : "아니오") << endl;
+
+    // 벤치마크
+    /*
+     * 코어가 하나뿐인 환경에서는 스레드들이 번갈아 실행되므로 확장성은 보이지
+     * 않습니다.
+     */
+    const long long OPS = 2000000;
+    const int PREFILL = 1000;
+    long long checksum = 0;
+
+    cout << "\n[스레드마다 넣기/꺼내기 반복, 코어 " << thread::hardware_concurrency() << "개]\n";
+    for (int threads : { 1, 2, 4, 8 })
+    {
+        size_t before = NodeDomain<int>::allocated_count();
+        double lockFree = measure_throughput<Queue<int>>(threads, OPS / threads, PREFILL, checksum);
+        size_t allocated = NodeDomain<int>::allocated_count() - before;
+        double locked = measure_throughput<LockedLinkedListQueue>(threads, OPS / threads, PREFILL, checksum);
+
+        cout << "스레드 " << threads << "개 - Michael-Scott: " << lockFree / 1e6 << " M ops/s (새로 할당한 노드 "
+             << allocated << "개), 뮤텍스 연결 리스트: " << locked / 1e6 << " M ops/s\n";
+    }
+    cout << "(checksum " << checksum << ")" << endl;
+
+    return 0;
+}
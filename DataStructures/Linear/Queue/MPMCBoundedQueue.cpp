@@ -0,0 +1,463 @@
+/*
+ * 다중 생산자/다중 소비자 유한 큐 (Bounded MPMC Queue, Vyukov)
+ *
+ * 원형 큐(CircularQueue.cpp)의 배열을 여러 스레드가 동시에 넣고 꺼낼 수 있도록
+ * 확장한 구조로, 락을 전혀 사용하지 않습니다.
+ *
+ * 배열의 칸(slot)마다 순번(sequence)을 두어 그 칸의 상태를 나타냅니다.
+ * - 위치 pos 의 칸에 넣을 수 있으면 sequence == pos
+ * - 위치 pos 의 칸에서 꺼낼 수 있으면 sequence == pos + 1
+ * 생산자는 enqueuePos 를 CAS 로 한 칸 차지한 뒤 값을 쓰고 sequence 를 pos + 1
+ * 로 바꾸며, 소비자는 dequeuePos 를 차지한 뒤 값을 읽고 sequence 를
+ * pos + capacity(다음 바퀴에 넣을 위치)로 바꿉니다. 스레드들은 서로 다른 칸에서
+ * 작업하므로, 경쟁하는 곳은 두 위치 변수의 CAS 뿐입니다.
+ *
+ * 가득 찼거나 비었을 때의 동작은 세 가지입니다.
+ * - try_: 바로 false 를 반환합니다.
+ * - 기본(enqueue, dequeue): 잠시 돌며(spin) 다시 시도하다가, 그래도 안 되면
+ *   조건 변수에서 잠듭니다(park). 반대편 연산이 성공하면 잠든 스레드를 깨웁니다.
+ * - _for: 위와 같지만 정한 시간이 지나면 false 를 반환합니다.
+ *
+ */
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+
+using namespace std;
+
+template <typename T>
+class Queue
+{
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr int SPIN_COUNT = 64;
+
+    struct alignas(CACHE_LINE) Cell
+    {
+        atomic<size_t> sequence;
+        T data;
+    };
+
+    size_t capacity;
+    size_t mask;
+    unique_ptr<Cell[]> cells;
+
+    alignas(CACHE_LINE) atomic<size_t> enqueuePos;
+    alignas(CACHE_LINE) atomic<size_t> dequeuePos;
+
+    // 잠든 스레드 관리 (가득 참/비어 있음 각각)
+    alignas(CACHE_LINE) mutex parkLock;
+    condition_variable notFull;
+    condition_variable notEmpty;
+    atomic<int> fullWaiters;
+    atomic<int> emptyWaiters;
+
+public:
+    // 용량은 c 이상인 가장 작은 2의 거듭제곱으로 정해집니다. (최소 2)
+    Queue(size_t c) : enqueuePos(0), dequeuePos(0), fullWaiters(0), emptyWaiters(0)
+    {
+        if (c == 0)
+        {
+            throw invalid_argument("Capacity must be positive");
+        }
+
+        capacity = 2;
+        while (capacity < c)
+        {
+            capacity <<= 1;
+        }
+        mask = capacity - 1;
+
+        cells.reset(new Cell[capacity]);
+        for (size_t i = 0; i < capacity; i++)
+        {
+            cells[i].sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    Queue(const Queue &) = delete;
+    Queue &operator=(const Queue &) = delete;
+
+    // 삽입 시도
+    /*
+     * 가득 찼다면 false 를 반환합니다.
+     * 시간 복잡도: O(1) (경쟁이 없을 때)
+     */
+    bool try_enqueue(const T &new_data)
+    {
+        if (!push(new_data))
+        {
+            return false;
+        }
+        wake(emptyWaiters, notEmpty);
+        return true;
+    }
+
+    // 삭제 시도
+    /*
+     * 앞의 값을 out 에 옮기고 제거합니다. 비어있다면 false 를 반환합니다.
+     * 시간 복잡도: O(1) (경쟁이 없을 때)
+     */
+    bool try_dequeue(T &out)
+    {
+        if (!pop(out))
+        {
+            return false;
+        }
+        wake(fullWaiters, notFull);
+        return true;
+    }
+
+    // 삽입 (가득 찼다면 빈 칸이 생길 때까지 기다립니다)
+    void enqueue(const T &new_data)
+    {
+        wait_until([&] { return push(new_data); }, fullWaiters, notFull, nullptr);
+        wake(emptyWaiters, notEmpty);
+    }
+
+    // 삭제 (비어있다면 값이 들어올 때까지 기다립니다)
+    T dequeue()
+    {
+        T out;
+        wait_until([&] { return pop(out); }, emptyWaiters, notEmpty, nullptr);
+        wake(fullWaiters, notFull);
+        return out;
+    }
+
+    // 삽입 (최대 timeout 만큼 기다립니다)
+    template <typename Rep, typename Period>
+    bool try_enqueue_for(const T &new_data, const chrono::duration<Rep, Period> &timeout)
+    {
+        auto deadline = chrono::steady_clock::now() + timeout;
+        if (!wait_until([&] { return push(new_data); }, fullWaiters, notFull, &deadline))
+        {
+            return false;
+        }
+        wake(emptyWaiters, notEmpty);
+        return true;
+    }
+
+    // 삭제 (최대 timeout 만큼 기다립니다)
+    template <typename Rep, typename Period>
+    bool try_dequeue_for(T &out, const chrono::duration<Rep, Period> &timeout)
+    {
+        auto deadline = chrono::steady_clock::now() + timeout;
+        if (!wait_until([&] { return pop(out); }, emptyWaiters, notEmpty, &deadline))
+        {
+            return false;
+        }
+        wake(fullWaiters, notFull);
+        return true;
+    }
+
+    // 다른 스레드가 동시에 수정 중일 수 있으므로 대략적인 값입니다.
+    size_t size_approx() const
+    {
+        size_t tail = enqueuePos.load(memory_order_acquire);
+        size_t head = dequeuePos.load(memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    size_t get_capacity() const
+    {
+        return capacity;
+    }
+
+private:
+    // 한 칸을 차지해 값을 씁니다. (잠든 스레드는 깨우지 않습니다)
+    bool push(const T &new_data)
+    {
+        size_t pos = enqueuePos.load(memory_order_relaxed);
+        Cell *cell;
+
+        while (true)
+        {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                // 비어 있는 칸: 위치를 차지합니다. (실패하면 pos 가 최신 값으로 바뀝니다)
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // 한 바퀴 전의 값이 아직 꺼내지지 않았습니다.
+                return false;
+            }
+            else
+            {
+                // 다른 생산자가 먼저 차지했습니다.
+                pos = enqueuePos.load(memory_order_relaxed);
+            }
+        }
+
+        cell->data = new_data;
+        cell->sequence.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    // 한 칸을 차지해 값을 꺼냅니다. (잠든 스레드는 깨우지 않습니다)
+    bool pop(T &out)
+    {
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        Cell *cell;
+
+        while (true)
+        {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0)
+            {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // 아직 값이 쓰이지 않았습니다.
+                return false;
+            }
+            else
+            {
+                pos = dequeuePos.load(memory_order_relaxed);
+            }
+        }
+
+        out = move(cell->data);
+        cell->sequence.store(pos + capacity, memory_order_release);
+        return true;
+    }
+
+    // 기다리기 (spin-then-park)
+    /*
+     * 먼저 SPIN_COUNT 번 다시 시도하며(절반이 지나면 다른 스레드에 양보),
+     * 그래도 실패하면 waiters 를 늘리고 조건 변수에서 잠듭니다.
+     * 반대편은 성공한 뒤 waiters 를 확인하므로, waiters 를 늘린 뒤 한 번 더
+     * 시도하고 잠들면 깨우는 신호를 놓치지 않습니다.
+     * deadline 이 nullptr 이면 성공할 때까지 기다립니다. 성공한 뒤 반대편을
+     * 깨우는 일은 호출한 쪽에서 락을 놓은 다음에 합니다.
+     */
+    template <typename Attempt>
+    bool wait_until(Attempt attempt, atomic<int> &waiters, condition_variable &cv,
+                    const chrono::steady_clock::time_point *deadline)
+    {
+        for (int spin = 0; spin < SPIN_COUNT; spin++)
+        {
+            if (attempt())
+            {
+                return true;
+            }
+            if (spin >= SPIN_COUNT / 2)
+            {
+                this_thread::yield();
+            }
+        }
+
+        unique_lock<mutex> guard(parkLock);
+        waiters.fetch_add(1);
+        atomic_thread_fence(memory_order_seq_cst);
+
+        bool success = false;
+        while (!(success = attempt()))
+        {
+            if (deadline == nullptr)
+            {
+                cv.wait(guard);
+            }
+            else if (cv.wait_until(guard, *deadline) == cv_status::timeout)
+            {
+                success = attempt();
+                break;
+            }
+        }
+
+        waiters.fetch_sub(1);
+        if (!success && waiters.load() > 0)
+        {
+            // 받은 신호를 쓰지 않고 포기했다면 다른 대기자에게 넘깁니다.
+            cv.notify_one();
+        }
+        return success;
+    }
+
+    // 잠든 스레드가 있을 때만 락을 잡고 깨웁니다.
+    void wake(atomic<int> &waiters, condition_variable &cv)
+    {
+        atomic_thread_fence(memory_order_seq_cst);
+        if (waiters.load(memory_order_relaxed) > 0)
+        {
+            lock_guard<mutex> guard(parkLock);
+            cv.notify_one();
+        }
+    }
+};
+
+// 비교용: 뮤텍스와 조건 변수로 감싼 원형 큐 (CircularQueue.cpp 와 같은 구조)
+class LockedCircularQueue
+{
+    int *arr;
+    int front;
+    int size;
+    int capacity;
+    mutex lock;
+    condition_variable notFull;
+    condition_variable notEmpty;
+
+public:
+    LockedCircularQueue(int c)
+    {
+        arr = new int[c];
+        front = 0;
+        size = 0;
+        capacity = c;
+    }
+
+    ~LockedCircularQueue()
+    {
+        delete[] arr;
+    }
+
+    void enqueue(const int &new_data)
+    {
+        unique_lock<mutex> guard(lock);
+        notFull.wait(guard, [&] { return size < capacity; });
+        arr[(front + size) % capacity] = new_data;
+        size++;
+        notEmpty.notify_one();
+    }
+
+    int dequeue()
+    {
+        unique_lock<mutex> guard(lock);
+        notEmpty.wait(guard, [&] { return size > 0; });
+        int value = arr[front];
+        front = (front + 1) % capacity;
+        size--;
+        notFull.notify_one();
+        return value;
+    }
+};
+
+// 생산자 producers 개가 각각 perProducer 개를 넣고 소비자 consumers 개가 모두
+// 꺼낼 때의 처리량(초당 연산 수)
+template <typename Q>
+double measure_throughput(int producers, int consumers, long long perProducer, long long &checksum)
+{
+    Q q(1024);
+    long long total = producers * perProducer;
+    atomic<long long> remaining(total);
+    atomic<long long> sum(0);
+    vector<thread> threads;
+
+    auto start = chrono::steady_clock::now();
+    for (int p = 0; p < producers; p++)
+    {
+        threads.emplace_back([&]
+            {
+                for (long long i = 0; i < perProducer; i++)
+                {
+                    q.enqueue(static_cast<int>(i));
+                }
+            });
+    }
+    for (int c = 0; c < consumers; c++)
+    {
+        threads.emplace_back([&]
+            {
+                long long local = 0;
+                // 꺼낼 몫을 먼저 차지한 소비자만 dequeue 를 호출합니다.
+                while (remaining.fetch_sub(1) > 0)
+                {
+                    local += q.dequeue();
+                }
+                sum += local;
+            });
+    }
+    for (thread &t : threads)
+    {
+        t.join();
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    checksum += sum;
+    return total / elapsed.count();
+}
+
+int main()
+{
+    Queue<int> q(4);
+
+    cout << "큐에 값을 추가합니다: 10, 20, 30, 40, 50" << endl;
+    for (int value : { 10, 20, 30, 40, 50 })
+    {
+        if (!q.try_enqueue(value))
+        {
+            cout << "  " << value << ": 큐가 가득 찼습니다." << endl;
+        }
+    }
+
+    cout << "50을 최대 10ms 동안 기다리며 넣습니다: "
+         << (q.try_enqueue_for(50, chrono::milliseconds(10)) ? "성공" : "시간 초과") << endl;
+
+    cout << "\n다른 스레드가 5ms 뒤에 값 하나를 꺼냅니다." << endl;
+    thread consumer([&]
+        {
+            this_thread::sleep_for(chrono::milliseconds(5));
+            q.dequeue();
+        });
+    q.enqueue(50);
+    consumer.join();
+    cout << "기다린 끝에 50을 넣었습니다." << endl;
+
+    cout << "\n남은 값: ";
+    int value;
+    while (q.try_dequeue(value))
+    {
+        cout << value << " ";
+    }
+    cout << endl;
+
+    cout << "빈 큐에서 최대 10ms 동안 꺼내기: "
+         << (q.try_dequeue_for(value, chrono::milliseconds(10)) ? "성공" : "시간 초과") << endl;
+
+    // 벤치마크
+    /*
+     * 생산자:소비자 비율을 바꿔 가며 용량 1024 의 큐로 값을 전달합니다.
+     * 코어가 하나뿐인 환경에서는 스레드들이 번갈아 실행되므로 확장성은 보이지
+     * 않습니다.
+     */
+    const long long TOTAL = 4000000;
+    long long checksum = 0;
+    int pairs[][2] = { { 1, 1 }, { 1, 4 }, { 4, 1 }, { 2, 2 }, { 4, 4 } };
+
+    cout << "\n[값 " << TOTAL << "개 전달, 코어 " << thread::hardware_concurrency() << "개]\n";
+    for (auto &pair : pairs)
+    {
+        int producers = pair[0];
+        int consumers = pair[1];
+        long long perProducer = TOTAL / producers;
+
+        double lockFree = measure_throughput<Queue<int>>(producers, consumers, perProducer, checksum);
+        double locked = measure_throughput<LockedCircularQueue>(producers, consumers, perProducer, checksum);
+        cout << "생산자 " << producers << " : 소비자 " << consumers << " - MPMC: " << lockFree / 1e6
+             << " M ops/s, 뮤텍스 원형 큐: " << locked / 1e6 << " M ops/s\n";
+    }
+    cout << "(checksum " << checksum << ")" << endl;
+
+    return 0;
+}